@@ -90,7 +90,7 @@ class configuration:
   with_numpy = True
 
   # The vector length used for the VectorizedSolver class. This will used
-  # as a hint for the Intel compiler to issue SIMD (ie, SSE, AVX, etc) vector
+  # as a hint for the compiler to issue SIMD (ie, SSE, AVX, etc) vector
   # instructions. This is accomplished by adding "dummy" energy groups such
   # that the number of energy groups is be fit too a multiple of this
   # vector_length, and restructuring the innermost loops in the solver to
@@ -98,7 +98,8 @@ class configuration:
   vector_length = 8
 
   # The vector alignment used in the VectorizedSolver class when allocating
-  # aligned data structures using _mm_malloc and _mm_free
+  # aligned data structures using simd_malloc and simd_free (which align to at
+  # least 64 bytes for AVX-512 vectors)
   vector_alignment = 16
 
   # List of C/C++/CUDA distutils.extension objects which are created based
@@ -128,12 +129,18 @@ class configuration:
                     'src/Geometry.cpp',
                     'src/LocalCoords.cpp',
                     'src/log.cpp',
+                    'src/numa.cpp',
                     'src/Material.cpp',
                     'src/Point.cpp',
                     'src/Quadrature.cpp',
                     'src/Solver.cpp',
                     'src/CPUSolver.cpp',
                     'src/ThreadPrivateSolver.cpp',
+                    'src/BatchedSolver.cpp',
+                    'src/GroupBlockedSolver.cpp',
+                    'src/VectorizedSolver.cpp',
+                    'src/VectorizedPrivateSolver.cpp',
+                    'src/simd.cpp',
                     'src/Surface.cpp',
                     'src/Timer.cpp',
                     'src/Track.cpp',
@@ -147,14 +154,18 @@ class configuration:
                      'src/Geometry.cpp',
                      'src/LocalCoords.cpp',
                      'src/log.cpp',
+                     'src/numa.cpp',
                      'src/Material.cpp',
                      'src/Point.cpp',
                      'src/Quadrature.cpp',
                      'src/Solver.cpp',
                      'src/CPUSolver.cpp',
                      'src/ThreadPrivateSolver.cpp',
+                     'src/BatchedSolver.cpp',
+                     'src/GroupBlockedSolver.cpp',
                      'src/VectorizedSolver.cpp',
                      'src/VectorizedPrivateSolver.cpp',
+                     'src/simd.cpp',
                      'src/Surface.cpp',
                      'src/Timer.cpp',
                      'src/Track.cpp',
@@ -168,12 +179,15 @@ class configuration:
                       'src/Geometry.cpp',
                       'src/LocalCoords.cpp',
                       'src/log.cpp',
+                      'src/numa.cpp',
                       'src/Material.cpp',
                       'src/Point.cpp',
                       'src/Quadrature.cpp',
                       'src/Solver.cpp',
                       'src/CPUSolver.cpp',
                       'src/ThreadPrivateSolver.cpp',
+                      'src/BatchedSolver.cpp',
+                      'src/GroupBlockedSolver.cpp',
                       'src/Surface.cpp',
                       'src/Timer.cpp',
                       'src/Track.cpp',
@@ -239,7 +253,7 @@ class configuration:
 
   shared_libraries['gcc'] = ['stdc++', 'gomp', 'dl','pthread', 'm']
   shared_libraries['icpc'] = ['stdc++', 'iomp5', 'pthread', 'irc',
-                              'imf','rt', 'mkl_rt','m',]
+                              'imf','rt', 'm',]
   shared_libraries['nvcc'] = ['cudart']
   shared_libraries['bgxlc'] = ['stdc++', 'pthread', 'm', 'xlsmp', 'rt']
 
@@ -314,7 +328,6 @@ class configuration:
   macros['icpc']['single']= [('FP_PRECISION', 'float'), 
                              ('SINGLE', None),
                              ('INTEL', None),
-                             ('MKL_ILP64', None),
                              ('VEC_LENGTH', vector_length),
                              ('VEC_ALIGNMENT', vector_alignment)]
   
@@ -339,7 +352,6 @@ class configuration:
   macros['icpc']['double'] = [('FP_PRECISION', 'double'),
                               ('DOUBLE', None),
                               ('INTEL', None),
-                              ('MKL_ILP64', None),
                               ('VEC_LENGTH', vector_length),
                               ('VEC_ALIGNMENT', vector_alignment)]
 
@@ -6,12 +6,16 @@
   #include "../../../src/Geometry.h"
   #include "../../../src/LocalCoords.h"
   #include "../../../src/log.h"
+  #include "../../../src/numa.h"
   #include "../../../src/Material.h"
   #include "../../../src/Point.h"
   #include "../../../src/Quadrature.h"
+  #include "../../../src/simd.h"
   #include "../../../src/Solver.h"
   #include "../../../src/CPUSolver.h"
   #include "../../../src/ThreadPrivateSolver.h"
+  #include "../../../src/BatchedSolver.h"
+  #include "../../../src/GroupBlockedSolver.h"
   #include "../../../src/VectorizedSolver.h"
   #include "../../../src/VectorizedPrivateSolver.h"
   #include "../../../src/Surface.h"
@@ -243,6 +247,11 @@
  * getCellIds method for the data processing routines in openmoc.process */
 %apply (int* ARGOUT_ARRAY1, int DIM1) {(int* cell_ids, int num_cells)}
 
+/* The typemap used to match the method signature for the Geometry's
+ * renumberFSRs method such that users may renumber the FSRs in any order
+ * with a NumPy array */
+%apply (int* IN_ARRAY1, int DIM1) {(int* fsr_ids, int num_FSRs)}
+
 #endif
 
 
@@ -251,12 +260,16 @@
 %include ../../../src/Geometry.h
 %include ../../../src/LocalCoords.h
 %include ../../../src/log.h
+%include ../../../src/numa.h
 %include ../../../src/Material.h
 %include ../../../src/Point.h
 %include ../../../src/Quadrature.h
+%include ../../../src/simd.h
 %include ../../../src/Solver.h
 %include ../../../src/CPUSolver.h
 %include ../../../src/ThreadPrivateSolver.h
+%include ../../../src/BatchedSolver.h
+%include ../../../src/GroupBlockedSolver.h
 %include ../../../src/VectorizedSolver.h
 %include ../../../src/VectorizedPrivateSolver.h
 %include ../../../src/Surface.h
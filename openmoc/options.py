@@ -76,6 +76,12 @@ class Options:
     ## The default CMFD mesh level
     self._cmfd_mesh_level = -1
 
+    ## The default pages backing the segments and boundary fluxes
+    self._huge_pages = 0
+
+    ## Whether to count the data TLB misses during the source iterations
+    self._count_tlb_misses = False
+
     # Parse in arguments from the command line
     self.parseArguments()
 
@@ -88,7 +94,7 @@ class Options:
   def parseArguments(self):
     try:
       opts, args = getopt.getopt(sys.argv[1:],
-                                 'hfa:s:i:c:t:b:g:r:l:',
+                                 'hfa:s:i:c:t:b:g:r:l:p:',
                                  ['help',
                                   'num-azim=',
                                   'track-spacing=',
@@ -99,7 +105,8 @@ class Options:
                                   'num-gpu-threads=',
                                   'relax-factor=',
                                   'cmfd-acceleration',
-                                  'mesh-level='])
+                                  'mesh-level=',
+                                  'huge-pages='])
 
     except getopt.GetoptError as err:
       log.py_printf('WARNING', str(err))
@@ -163,6 +170,14 @@ class Options:
         mesh_level += 'The mesh level\n'
         print mesh_level
 
+        huge_pages = '\t{: <35}'.format('-p, --huge-pages=<0>')
+        huge_pages += 'The huge pages for segments and fluxes\n'
+        huge_pages += '\t{: <35}'.format('')
+        huge_pages += '(0: none, 1: transparent, 2: 2 MB, 3: 1 GB),\n'
+        huge_pages += '\t{: <35}'.format('')
+        huge_pages += 'and count the data TLB misses\n'
+        print huge_pages
+
         sys.exit()
 
       elif opt in ('-a', '--num-azim'):
@@ -195,6 +210,10 @@ class Options:
       elif opt in ('-l', '--mesh-level'):
         self._cmfd_mesh_level = int(arg)
 
+      elif opt in ('-p', '--huge-pages'):
+        self._huge_pages = int(arg)
+        self._count_tlb_misses = True
+
 
   ##
   # @brief Returns the number of azimuthal angles.
@@ -264,3 +283,20 @@ class Options:
   # @return the number of CMFD multigrid mesh levels
   def getCmfdMeshLevel(self):
     return self._cmfd_mesh_level
+
+
+  ##
+  # @brief Returns the pages backing the segments and boundary fluxes.
+  # @details The value is one of NO_HUGE_PAGES (0), TRANSPARENT_HUGE_PAGES
+  #          (1), HUGE_PAGES_2MB (2) or HUGE_PAGES_1GB (3).
+  # @return the huge pages for the segments and boundary fluxes
+  def getHugePages(self):
+    return self._huge_pages
+
+
+  ##
+  # @brief Returns whether to count the data TLB misses during the source
+  #        iterations, which is the case if the huge pages were specified.
+  # @return whether to count the data TLB misses
+  def getCountTLBMisses(self):
+    return self._count_tlb_misses
@@ -295,6 +295,10 @@ def store_simulation_state(solver, fluxes=False, sources=False,
     solver_type = 'CPUSolver'
   elif 'ThreadPrivateSolver' in str(solver.__class__):
     solver_type = 'ThreadPrivateSolver'
+  elif 'BatchedSolver' in str(solver.__class__):
+    solver_type = 'BatchedSolver'
+  elif 'GroupBlockedSolver' in str(solver.__class__):
+    solver_type = 'GroupBlockedSolver'
   elif 'VectorizedSolver' in str(solver.__class__):
     solver_type = 'VectorizedSolver'
   elif 'VectorizedPrivateSolver' in str(solver.__class__):
@@ -19,6 +19,8 @@ max_iters = options.getMaxIterations()
 acceleration = options.getCmfdAcceleration()
 relax_factor = options.getCmfdRelaxationFactor()
 mesh_level = options.getCmfdMeshLevel()
+huge_pages = options.getHugePages()
+count_tlb_misses = options.getCountTLBMisses()
 
 log.set_log_level('NORMAL')
 
@@ -352,6 +354,7 @@ cmfd.setOmega(1.0)
 log.py_printf('NORMAL', 'Initializing the track generator...')
 
 track_generator = TrackGenerator(geometry, num_azim, track_spacing)
+track_generator.setHugePages(huge_pages)
 track_generator.generateTracks()
 
 ###############################################################################
@@ -361,6 +364,8 @@ track_generator.generateTracks()
 solver = ThreadPrivateSolver(geometry, track_generator, cmfd)
 solver.setSourceConvergenceThreshold(tolerance)
 solver.setNumThreads(num_threads)
+solver.setHugePages(huge_pages)
+solver.setCountTLBMisses(count_tlb_misses)
 solver.convergeSource(max_iters)
 solver.printTimerReport()
 
@@ -0,0 +1,1520 @@
+#include "BatchedSolver.h"
+
+
+/**
+ * @brief Constructor initializes the array pointers for the cases.
+ * @details The constructor sets a default of one case with the Geometry's
+ *          Materials.
+ * @param geometry an optional pointer to the Geometry
+ * @param track_generator an optional pointer to the TrackGenerator
+ * @param cmfd an optional pointer to a Cmfd object object
+ */
+BatchedSolver::BatchedSolver(Geometry* geometry,
+                             TrackGenerator* track_generator, Cmfd* cmfd)
+  : CPUSolver(geometry, track_generator, cmfd) {
+
+  _num_active_cases = 0;
+  _lane_cases = NULL;
+  _case_lanes = NULL;
+  _case_k_eff = NULL;
+  _case_residuals = NULL;
+  _case_num_iterations = NULL;
+
+  _num_batched_materials = 0;
+  _FSR_material_indices = NULL;
+  _batched_sigma_t = NULL;
+  _batched_sigma_a = NULL;
+  _batched_sigma_s = NULL;
+  _batched_sigma_f = NULL;
+  _batched_nu_sigma_f = NULL;
+  _batched_chi = NULL;
+
+  _lane_norm_factors = NULL;
+  _thread_exponentials = NULL;
+
+  _num_cases = 0;
+  setNumCases(1);
+}
+
+
+/**
+ * @brief Destructor deletes the arrays for the cases and calls the
+ *        CPUSolver parent class destructor.
+ */
+BatchedSolver::~BatchedSolver() {
+
+  deleteBatchedMaterials();
+
+  if (_lane_cases != NULL)
+    delete [] _lane_cases;
+
+  if (_case_lanes != NULL)
+    delete [] _case_lanes;
+
+  if (_case_k_eff != NULL)
+    delete [] _case_k_eff;
+
+  if (_case_residuals != NULL)
+    delete [] _case_residuals;
+
+  if (_case_num_iterations != NULL)
+    delete [] _case_num_iterations;
+
+  if (_lane_norm_factors != NULL)
+    delete [] _lane_norm_factors;
+
+  if (_thread_exponentials != NULL)
+    delete [] _thread_exponentials;
+}
+
+
+/**
+ * @brief Returns the number of cases.
+ * @return the number of cases
+ */
+int BatchedSolver::getNumCases() {
+  return _num_cases;
+}
+
+
+/**
+ * @brief Returns the eigenvalue for a case.
+ * @param case_id the case of interest
+ * @return the value of \f$ k_{eff} \f$ for the case
+ */
+FP_PRECISION BatchedSolver::getCaseKeff(int case_id) {
+
+  if (case_id < 0 || case_id >= _num_cases)
+    log_printf(ERROR, "Unable to return the eigenvalue for case %d since "
+               "the Solver has %d cases", case_id, _num_cases);
+
+  if (_case_k_eff == NULL)
+    log_printf(ERROR, "Unable to return the eigenvalue for case %d since "
+               "the source has not yet been converged", case_id);
+
+  return _case_k_eff[case_id];
+}
+
+
+/**
+ * @brief Returns the number of source iterations for a case to converge.
+ * @param case_id the case of interest
+ * @return the number of source iterations
+ */
+int BatchedSolver::getCaseNumIterations(int case_id) {
+
+  if (case_id < 0 || case_id >= _num_cases)
+    log_printf(ERROR, "Unable to return the number of iterations for case "
+               "%d since the Solver has %d cases", case_id, _num_cases);
+
+  if (_case_num_iterations == NULL)
+    log_printf(ERROR, "Unable to return the number of iterations for case "
+               "%d since the source has not yet been converged", case_id);
+
+  return _case_num_iterations[case_id];
+}
+
+
+/**
+ * @brief Returns the scalar flux for a case in some FSR and energy group.
+ * @param case_id the case of interest
+ * @param fsr_id the ID for the FSR of interest
+ * @param energy_group the energy group of interest
+ * @return the FSR scalar flux
+ */
+FP_PRECISION BatchedSolver::getCaseFSRScalarFlux(int case_id, int fsr_id,
+                                                 int energy_group) {
+
+  if (case_id < 0 || case_id >= _num_cases)
+    log_printf(ERROR, "Unable to return a scalar flux for case %d since "
+               "the Solver has %d cases", case_id, _num_cases);
+
+  if (fsr_id < 0 || fsr_id >= _num_FSRs)
+    log_printf(ERROR, "Unable to return a scalar flux for FSR ID = %d "
+               "since the Solver contains %d FSRs", fsr_id, _num_FSRs);
+
+  if (energy_group <= 0 || energy_group > _num_groups)
+    log_printf(ERROR, "Unable to return a scalar flux in energy group %d "
+               "since the Solver has %d energy groups", energy_group,
+               _num_groups);
+
+  int r = _geometry->getInternalFSRId(fsr_id);
+
+  return _batched_scalar_flux(r, energy_group-1, _case_lanes[case_id]);
+}
+
+
+/**
+ * @brief Returns the scalar flux for the first case in some FSR and
+ *        energy group.
+ * @param fsr_id the ID for the FSR of interest
+ * @param energy_group the energy group of interest
+ * @return the FSR scalar flux
+ */
+FP_PRECISION BatchedSolver::getFSRScalarFlux(int fsr_id, int energy_group) {
+  return getCaseFSRScalarFlux(0, fsr_id, energy_group);
+}
+
+
+/**
+ * @brief Returns the source for the first case in some FSR and energy group.
+ * @param fsr_id the ID for the FSR of interest
+ * @param energy_group the energy group of interest
+ * @return the FSR source
+ */
+FP_PRECISION BatchedSolver::getFSRSource(int fsr_id, int energy_group) {
+
+  if (fsr_id < 0 || fsr_id >= _num_FSRs)
+    log_printf(ERROR, "Unable to return a source for FSR ID = %d "
+               "since the Solver contains %d FSRs", fsr_id, _num_FSRs);
+
+  if (energy_group <= 0 || energy_group > _num_groups)
+    log_printf(ERROR, "Unable to return a source in energy group %d "
+               "since the Solver has %d energy groups", energy_group,
+               _num_groups);
+
+  int r = _geometry->getInternalFSRId(fsr_id);
+
+  return _batched_source(r, energy_group-1, _case_lanes[0]);
+}
+
+
+/**
+ * @brief Sets the number of cases to converge together (>0).
+ * @details Each case uses the Geometry's Materials unless some of them are
+ *          replaced with BatchedSolver::setCaseMaterial(...). The cases are
+ *          vectorized, so a multiple of the vector width is most efficient.
+ *          This may be called from Python as follows:
+ *
+ * @code
+ *          solver = openmoc.BatchedSolver(geometry, track_generator)
+ *          solver.setNumCases(16)
+ * @endcode
+ *
+ * @param num_cases the number of cases
+ */
+void BatchedSolver::setNumCases(int num_cases) {
+
+  if (num_cases <= 0)
+    log_printf(ERROR, "Unable to set the number of cases to %d since it is "
+               "less than or equal to 0", num_cases);
+
+  _num_cases = num_cases;
+  _case_materials.resize(num_cases);
+
+  /* Delete the results for the previous number of cases */
+  if (_case_k_eff != NULL)
+    delete [] _case_k_eff;
+
+  if (_case_residuals != NULL)
+    delete [] _case_residuals;
+
+  if (_case_num_iterations != NULL)
+    delete [] _case_num_iterations;
+
+  if (_lane_cases != NULL)
+    delete [] _lane_cases;
+
+  if (_case_lanes != NULL)
+    delete [] _case_lanes;
+
+  _case_k_eff = NULL;
+  _case_residuals = NULL;
+  _case_num_iterations = NULL;
+  _lane_cases = new int[num_cases];
+  _case_lanes = new int[num_cases];
+
+  for (int c=0; c < num_cases; c++) {
+    _lane_cases[c] = c;
+    _case_lanes[c] = c;
+  }
+}
+
+
+/**
+ * @brief Replaces a Material of the Geometry by another Material for a case.
+ * @details The Material must have the same number of energy groups as the
+ *          Geometry's Materials. A perturbed copy of the fuel may be used
+ *          for the second case from Python as follows:
+ *
+ * @code
+ *          perturbed_fuel = fuel.clone()
+ *          perturbed_fuel.setSigmaA(perturbed_sigma_a)
+ *          solver.setCaseMaterial(1, fuel.getId(), perturbed_fuel)
+ * @endcode
+ *
+ * @param case_id the case for which to replace the Material
+ * @param material_id the ID of the Geometry's Material to replace
+ * @param material the Material replacing it in this case
+ */
+void BatchedSolver::setCaseMaterial(int case_id, int material_id,
+                                    Material* material) {
+
+  if (case_id < 0 || case_id >= _num_cases)
+    log_printf(ERROR, "Unable to set a Material for case %d since the "
+               "Solver has %d cases", case_id, _num_cases);
+
+  _case_materials[case_id][material_id] = material;
+}
+
+
+/**
+ * @brief Allocates memory for Track boundary angular flux and leakage and
+ *        FSR scalar flux arrays for all of the cases.
+ * @details Deletes memory for old flux arrays if they were allocated for a
+ *          previous simulation.
+ */
+void BatchedSolver::initializeFluxArrays() {
+
+  if (_boundary_flux_single_precision)
+    log_printf(ERROR, "Unable to store the boundary fluxes in single "
+               "precision for the BatchedSolver");
+
+  /* Delete old flux arrays if they exist */
+  huge_page_free(_boundary_flux);
+  huge_page_free(_boundary_leakage);
+
+  if (_scalar_flux != NULL)
+    delete [] _scalar_flux;
+
+  if (_thread_fsr_flux != NULL)
+    delete [] _thread_fsr_flux;
+
+  if (_thread_exponentials != NULL)
+    delete [] _thread_exponentials;
+
+  if (_lane_norm_factors != NULL)
+    delete [] _lane_norm_factors;
+
+  long size;
+
+  /* Allocate memory for the Track boundary flux and leakage arrays */
+  try{
+    size = 2 * (long)_tot_num_tracks * _polar_times_groups * _num_cases;
+    _boundary_flux = (FP_PRECISION*)
+         huge_page_malloc(size * sizeof(FP_PRECISION), _huge_pages);
+    _boundary_leakage = (FP_PRECISION*)
+         huge_page_malloc(size * sizeof(FP_PRECISION), _huge_pages);
+
+    /* Allocate an array for the FSR scalar flux */
+    size = (long)_num_FSRs * _num_groups * _num_cases;
+    _scalar_flux = new FP_PRECISION[size];
+
+    /* Allocate thread local memory buffers for the FSR scalar flux and
+     * the exponentials */
+    size = _num_groups * _num_cases * _num_threads;
+    _thread_fsr_flux = new FP_PRECISION[size];
+    memset(_thread_fsr_flux, 0, size * sizeof(FP_PRECISION));
+
+    _thread_exponentials = new FP_PRECISION[_num_cases * _num_threads];
+    _lane_norm_factors = new FP_PRECISION[_num_cases];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the Solver's fluxes. "
+               "Backtrace:%s", e.what());
+  }
+}
+
+
+/**
+ * @brief Allocates memory for FSR source arrays for all of the cases.
+ * @details The source residuals and the FSR fission and absorption rates
+ *          are stored for all FSRs of each lane in turn, such that they are
+ *          reduced across FSRs for each case without strides.
+ */
+void BatchedSolver::initializeSourceArrays() {
+
+  /* Delete old sources arrays if they exist */
+  if (_fission_sources != NULL)
+    delete [] _fission_sources;
+
+  if (_source != NULL)
+    delete [] _source;
+
+  if (_old_source != NULL)
+    delete [] _old_source;
+
+  if (_reduced_source != NULL)
+    delete [] _reduced_source;
+
+  if (_source_residuals != NULL)
+    delete [] _source_residuals;
+
+  if (_FSR_fission_rates != NULL)
+    delete [] _FSR_fission_rates;
+
+  if (_FSR_absorption_rates != NULL)
+    delete [] _FSR_absorption_rates;
+
+  long size;
+
+  /* Allocate memory for all source arrays */
+  try{
+    size = (long)_num_FSRs * _num_groups * _num_cases;
+    _source = new FP_PRECISION[size];
+    _old_source = new FP_PRECISION[size];
+    _reduced_source = new FP_PRECISION[size];
+
+    size = (long)_num_FSRs * _num_cases;
+    _fission_sources = new FP_PRECISION[size];
+    _source_residuals = new FP_PRECISION[size];
+    _FSR_fission_rates = new FP_PRECISION[size];
+    _FSR_absorption_rates = new FP_PRECISION[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the solver's FSR "
+               "sources array. Backtrace:%s", e.what());
+  }
+}
+
+
+/**
+ * @brief Initializes the FSR volumes and Materials and the cross-sections
+ *        for each case.
+ */
+void BatchedSolver::initializeFSRs() {
+  CPUSolver::initializeFSRs();
+  initializeCases();
+}
+
+
+/**
+ * @brief Gathers the cross-sections of each case's Materials into arrays
+ *        with the case as the innermost index.
+ * @details The cases are stored in order, such that each case's lane is
+ *          its index, and the results of each case are reset.
+ */
+void BatchedSolver::initializeCases() {
+
+  deleteBatchedMaterials();
+
+  std::map<int, Material*> materials = _geometry->getMaterials();
+  std::map<int, Material*>::iterator iter;
+  std::map<int, int> material_indices;
+  std::vector<Material*> base_materials;
+
+  for (iter=materials.begin(); iter != materials.end(); ++iter) {
+    material_indices[iter->second->getUid()] = base_materials.size();
+    base_materials.push_back(iter->second);
+  }
+
+  _num_batched_materials = base_materials.size();
+
+  long size = (long)_num_batched_materials * _num_groups * _num_cases;
+
+  try {
+    _FSR_material_indices = new int[_num_FSRs];
+    _batched_sigma_t = new FP_PRECISION[size];
+    _batched_sigma_a = new FP_PRECISION[size];
+    _batched_sigma_f = new FP_PRECISION[size];
+    _batched_nu_sigma_f = new FP_PRECISION[size];
+    _batched_chi = new FP_PRECISION[size];
+    _batched_sigma_s = new FP_PRECISION[size * _num_groups];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the cross-sections of "
+               "each case. Backtrace:%s", e.what());
+  }
+
+  for (int r=0; r < _num_FSRs; r++)
+    _FSR_material_indices[r] = material_indices[_FSR_materials[r]->getUid()];
+
+  /* Reset the results of each case, with each case in its own lane */
+  setNumCases(_num_cases);
+  _case_k_eff = new FP_PRECISION[_num_cases];
+  _case_residuals = new FP_PRECISION[_num_cases];
+  _case_num_iterations = new int[_num_cases];
+  _num_active_cases = _num_cases;
+
+  for (int c=0; c < _num_cases; c++) {
+    _case_k_eff[c] = 1.0;
+    _case_residuals[c] = 0.0;
+    _case_num_iterations[c] = 0;
+  }
+
+  /* Gather the cross-sections of the Material for each case */
+  for (int m=0; m < _num_batched_materials; m++)
+    gatherCaseMaterials(m, base_materials[m]);
+}
+
+
+/**
+ * @brief Gathers the cross-sections of a Material of the Geometry, or of
+ *        the Material replacing it, for the case in each lane.
+ * @param m the index of the Material in the batched cross-sections
+ * @param material a pointer to the Material of the Geometry
+ */
+void BatchedSolver::gatherCaseMaterials(int m, Material* material) {
+
+  for (int l=0; l < _num_cases; l++) {
+
+    int case_id = _lane_cases[l];
+    Material* case_material = material;
+    std::map<int, Material*>::iterator replacement =
+         _case_materials[case_id].find(material->getId());
+
+    if (replacement != _case_materials[case_id].end())
+      case_material = replacement->second;
+
+    if (case_material->getNumEnergyGroups() != _num_groups)
+      log_printf(ERROR, "Unable to use Material %d for case %d since it "
+                 "has %d energy groups rather than %d",
+                 case_material->getId(), case_id,
+                 case_material->getNumEnergyGroups(), _num_groups);
+
+    FP_PRECISION* sigma_s = case_material->getSigmaS();
+
+    for (int e=0; e < _num_groups; e++) {
+      _batched_xs(_batched_sigma_t,m,e,l) = case_material->getSigmaT()[e];
+      _batched_xs(_batched_sigma_a,m,e,l) = case_material->getSigmaA()[e];
+      _batched_xs(_batched_sigma_f,m,e,l) = case_material->getSigmaF()[e];
+      _batched_xs(_batched_nu_sigma_f,m,e,l) =
+           case_material->getNuSigmaF()[e];
+      _batched_xs(_batched_chi,m,e,l) = case_material->getChi()[e];
+
+      for (int g=0; g < _num_groups; g++)
+        _batched_sigma_s(m,e,g,l) = sigma_s[e*_num_groups+g];
+    }
+  }
+}
+
+
+/**
+ * @brief Gathers the cross-sections of each case again for the Materials
+ *        which have changed, and refreshes the exponential table if it no
+ *        longer spans every segment.
+ * @details The cross-sections are gathered into the current lane of each
+ *          case, such that the fluxes and sources in each lane are kept.
+ * @param materials the Materials whose cross-sections have changed, which
+ *                  may be Materials of the Geometry or replacing them
+ */
+void BatchedSolver::updateMaterials(std::vector<Material*>& materials) {
+
+  std::set<Material*> changed(materials.begin(), materials.end());
+  std::map<int, Material*> all_materials = _geometry->getMaterials();
+  std::map<int, Material*>::iterator iter;
+
+  if ((int)all_materials.size() != _num_batched_materials)
+    log_printf(ERROR, "Unable to update the cross-sections of each case "
+               "since the Geometry has %d Materials rather than %d",
+               (int)all_materials.size(), _num_batched_materials);
+
+  /* The Materials are indexed in the same order as in initializeCases() */
+  int m = 0;
+
+  for (iter=all_materials.begin(); iter != all_materials.end(); ++iter) {
+    Material* material = iter->second;
+    bool update = changed.count(material) > 0;
+
+    for (int c=0; c < _num_cases; c++) {
+      std::map<int, Material*>::iterator replacement =
+           _case_materials[c].find(material->getId());
+
+      if (replacement != _case_materials[c].end() &&
+          changed.count(replacement->second) > 0)
+        update = true;
+    }
+
+    if (update)
+      gatherCaseMaterials(m, material);
+
+    m++;
+  }
+
+  /* Rebuild the exponential table if it no longer spans every segment */
+  FP_PRECISION table_length =
+       (_exp_table_size / _two_times_num_polar) * _exp_table_spacing;
+
+  if (getMaxOpticalLength() > table_length)
+    buildExpInterpTable();
+}
+
+
+/**
+ * @brief Records a fingerprint of the cross-sections of each Material in
+ *        the Geometry and of each Material replacing one for a case.
+ */
+void BatchedSolver::recordCaseMaterialFingerprints() {
+
+  recordMaterialFingerprints();
+
+  for (int c=0; c < _num_cases; c++) {
+    std::map<int, Material*>::iterator iter;
+
+    for (iter=_case_materials[c].begin(); iter != _case_materials[c].end();
+         ++iter)
+      _material_fingerprints[iter->second->getUid()] =
+           computeMaterialFingerprint(iter->second);
+  }
+}
+
+
+/**
+ * @brief Deletes the cross-sections gathered for each case.
+ */
+void BatchedSolver::deleteBatchedMaterials() {
+
+  if (_FSR_material_indices != NULL)
+    delete [] _FSR_material_indices;
+
+  if (_batched_sigma_t != NULL)
+    delete [] _batched_sigma_t;
+
+  if (_batched_sigma_a != NULL)
+    delete [] _batched_sigma_a;
+
+  if (_batched_sigma_s != NULL)
+    delete [] _batched_sigma_s;
+
+  if (_batched_sigma_f != NULL)
+    delete [] _batched_sigma_f;
+
+  if (_batched_nu_sigma_f != NULL)
+    delete [] _batched_nu_sigma_f;
+
+  if (_batched_chi != NULL)
+    delete [] _batched_chi;
+
+  _FSR_material_indices = NULL;
+  _batched_sigma_t = NULL;
+  _batched_sigma_a = NULL;
+  _batched_sigma_s = NULL;
+  _batched_sigma_f = NULL;
+  _batched_nu_sigma_f = NULL;
+  _batched_chi = NULL;
+}
+
+
+/**
+ * @brief Returns the maximum optical length of any segment in any energy
+ *        group for any case.
+ * @return the maximum optical length
+ */
+FP_PRECISION BatchedSolver::getMaxOpticalLength() {
+
+  FP_PRECISION* max_sigma_t = new FP_PRECISION[_num_FSRs];
+  FP_PRECISION max_optical_length = 0.;
+  long size = (long)_num_groups * _num_cases;
+
+  /* Find the maximum total cross-section for each FSR */
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    FP_PRECISION* sigma_t =
+         &_batched_xs(_batched_sigma_t,_FSR_material_indices[r],0,0);
+    max_sigma_t[r] = 0.;
+
+    for (long i=0; i < size; i++)
+      max_sigma_t[r] = std::max(max_sigma_t[r], sigma_t[i]);
+  }
+
+  /* Find the maximum optical length over all segments */
+  segment* segments = _track_generator->getSegments();
+  int num_segments = _track_generator->getNumSegments();
+
+  for (int s=0; s < num_segments; s++)
+    max_optical_length = std::max(max_optical_length,
+         segments[s]._length * max_sigma_t[segments[s]._region_id]);
+
+  delete [] max_sigma_t;
+
+  return max_optical_length;
+}
+
+
+/**
+ * @brief Zero each Track's boundary fluxes for each energy group, polar
+ *        angle and case in the "forward" and "reverse" directions.
+ */
+void BatchedSolver::zeroTrackFluxes() {
+
+  long size = 2 * (long)_polar_times_groups * _num_cases;
+
+  #pragma omp parallel for schedule(guided)
+  for (int t=0; t < _tot_num_tracks; t++)
+    memset(&_batched_boundary_flux(t,0,0,0), 0, size * sizeof(FP_PRECISION));
+
+  return;
+}
+
+
+/**
+ * @brief Set the scalar flux for each FSR, energy group and case to some
+ *        value.
+ * @param value the value to assign to each FSR scalar flux
+ */
+void BatchedSolver::flattenFSRFluxes(FP_PRECISION value) {
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++) {
+      for (int c=0; c < _num_cases; c++)
+        _batched_scalar_flux(r,e,c) = value;
+    }
+  }
+
+  _FSR_rates_tallied = false;
+
+  return;
+}
+
+
+/**
+ * @brief Set the source for each FSR, energy group and case to some value.
+ * @param value the value to assign to each FSR source
+ */
+void BatchedSolver::flattenFSRSources(FP_PRECISION value) {
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++) {
+      for (int c=0; c < _num_cases; c++) {
+        _batched_source(r,e,c) = value;
+        _batched_old_source(r,e,c) = value;
+      }
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Tallies the volume-integrated fission (times \f$ \nu \f$) and
+ *        absorption rates in an FSR from its scalar fluxes for each case
+ *        which has not yet converged.
+ * @param fsr_id the ID for the FSR of interest
+ */
+void BatchedSolver::tallyFSRRates(int fsr_id) {
+
+  int m = _FSR_material_indices[fsr_id];
+  FP_PRECISION volume = _FSR_volumes[fsr_id];
+
+  for (int c=0; c < _num_active_cases; c++) {
+
+    FP_PRECISION absorption = 0.;
+    FP_PRECISION fission = 0.;
+
+    for (int e=0; e < _num_groups; e++) {
+      absorption += _batched_xs(_batched_sigma_a,m,e,c) *
+                    _batched_scalar_flux(fsr_id,e,c);
+      fission += _batched_xs(_batched_nu_sigma_f,m,e,c) *
+                 _batched_scalar_flux(fsr_id,e,c);
+    }
+
+    _FSR_absorption_rates[(long)c*_num_FSRs + fsr_id] = absorption * volume;
+    _FSR_fission_rates[(long)c*_num_FSRs + fsr_id] = fission * volume;
+  }
+}
+
+
+/**
+ * @brief Normalizes the FSR scalar fluxes and Track boundary angular fluxes
+ *        of each case which has not yet converged to its total fission
+ *        source (times \f$ \nu \f$).
+ * @details The FSR scalar fluxes are normalized in the same pass over the
+ *          FSRs as the source update by BatchedSolver::computeFSRSources().
+ */
+void BatchedSolver::normalizeFluxes() {
+
+  /* Tally the FSR fission rates if the fluxes were reset */
+  if (!_FSR_rates_tallied) {
+    #pragma omp parallel for schedule(guided)
+    for (int r=0; r < _num_FSRs; r++)
+      tallyFSRRates(r);
+  }
+
+  /* Compute the total fission source of each case */
+  for (int c=0; c < _num_active_cases; c++) {
+    FP_PRECISION tot_fission_source = parallel_pairwise_sum<FP_PRECISION>
+         (&_FSR_fission_rates[(long)c*_num_FSRs], _num_FSRs);
+    _lane_norm_factors[c] = 1.0 / tot_fission_source;
+  }
+
+  _FSR_rates_tallied = false;
+
+  /* Normalize angular boundary fluxes for each Track */
+  #pragma omp parallel for schedule(guided)
+  for (int i=0; i < _tot_num_tracks; i++) {
+    for (int j=0; j < 2; j++) {
+      for (int pe=0; pe < _polar_times_groups; pe++) {
+        FP_PRECISION* track_flux = &_batched_boundary_flux(i,j,pe,0);
+
+        #pragma omp simd
+        for (int c=0; c < _num_active_cases; c++)
+          track_flux[c] *= _lane_norm_factors[c];
+      }
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Computes the total source (fission and scattering) in each FSR for
+ *        each case which has not yet converged.
+ * @details The scalar fluxes are normalized by the factors from
+ *          BatchedSolver::normalizeFluxes(), and the residual of each case
+ *          is computed as for the CPUSolver.
+ * @return the largest residual of the cases which have not yet converged
+ */
+FP_PRECISION BatchedSolver::computeFSRSources() {
+
+  int num_active_cases = _num_active_cases;
+  FP_PRECISION* inverse_k_eff = new FP_PRECISION[num_active_cases];
+
+  for (int c=0; c < num_active_cases; c++)
+    inverse_k_eff[c] = 1.0 / _case_k_eff[_lane_cases[c]];
+
+  /* For each FSR, find the source of each case */
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    int m = _FSR_material_indices[r];
+    FP_PRECISION* fission_source = &_fission_sources[(long)r*_num_cases];
+
+    /* Normalize the scalar fluxes and compute the fission source */
+    for (int c=0; c < num_active_cases; c++) {
+      fission_source[c] = 0.;
+      _source_residuals[(long)c*_num_FSRs + r] = 0.;
+    }
+
+    for (int e=0; e < _num_groups; e++) {
+      FP_PRECISION* scalar_flux = &_batched_scalar_flux(r,e,0);
+      FP_PRECISION* nu_sigma_f = &_batched_xs(_batched_nu_sigma_f,m,e,0);
+
+      #pragma omp simd
+      for (int c=0; c < num_active_cases; c++) {
+        scalar_flux[c] *= _lane_norm_factors[c];
+        fission_source[c] += nu_sigma_f[c] * scalar_flux[c];
+      }
+    }
+
+    for (int c=0; c < num_active_cases; c++)
+      fission_source[c] *= inverse_k_eff[c];
+
+    /* Compute the total source in each group */
+    for (int G=0; G < _num_groups; G++) {
+      for (int c=0; c < num_active_cases; c++) {
+
+        FP_PRECISION scatter_source = 0.;
+        for (int g=0; g < _num_groups; g++)
+          scatter_source += _batched_sigma_s(m,G,g,c) *
+                            _batched_scalar_flux(r,g,c);
+
+        FP_PRECISION source = (fission_source[c] *
+             _batched_xs(_batched_chi,m,G,c) + scatter_source) *
+             ONE_OVER_FOUR_PI;
+
+        _batched_source(r,G,c) = source;
+        _batched_reduced_source(r,G,c) =
+             source / _batched_xs(_batched_sigma_t,m,G,c);
+
+        /* Compute the norm of residual of the source in the FSR */
+        if (fabs(source) > 1E-10)
+          _source_residuals[(long)c*_num_FSRs + r] +=
+               pow((source - _batched_old_source(r,G,c)) / source, 2);
+
+        /* Update the old source */
+        _batched_old_source(r,G,c) = source;
+      }
+    }
+  }
+
+  delete [] inverse_k_eff;
+
+  /* The scalar fluxes have been normalized */
+  for (int c=0; c < num_active_cases; c++)
+    _lane_norm_factors[c] = 1.0;
+
+  /* Sum up the residuals from each FSR for each case */
+  FP_PRECISION max_residual = 0.;
+
+  for (int c=0; c < num_active_cases; c++) {
+    FP_PRECISION residual = parallel_pairwise_sum<FP_PRECISION>
+         (&_source_residuals[(long)c*_num_FSRs], _num_FSRs);
+    residual = sqrt(residual / (_num_FSRs * _num_groups));
+
+    _case_residuals[_lane_cases[c]] = residual;
+    max_residual = std::max(max_residual, residual);
+  }
+
+  return max_residual;
+}
+
+
+/**
+ * @brief Compute \f$ k_{eff} \f$ from the total fission and absorption rates
+ *        for each case which has not yet converged.
+ */
+void BatchedSolver::computeKeff() {
+
+  long size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+
+  for (int c=0; c < _num_active_cases; c++) {
+
+    FP_PRECISION tot_abs = parallel_pairwise_sum<FP_PRECISION>
+         (&_FSR_absorption_rates[(long)c*_num_FSRs], _num_FSRs);
+    FP_PRECISION tot_fission = parallel_pairwise_sum<FP_PRECISION>
+         (&_FSR_fission_rates[(long)c*_num_FSRs], _num_FSRs);
+    FP_PRECISION leakage = parallel_pairwise_sum<FP_PRECISION>
+         (&_batched_boundary_leakage(c,0,0), size) * 0.5;
+
+    _case_k_eff[_lane_cases[c]] = tot_fission / (tot_abs + leakage);
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Computes the exponential term in the transport equation for a
+ *        Track segment for each case which has not yet converged.
+ * @param sigma_t the total cross-section of each case in the energy group
+ * @param length the length of the Track segment projected in the xy-plane
+ * @param p the polar angle index
+ * @param exponentials an array to store the exponential of each case
+ */
+void BatchedSolver::computeExponentials(FP_PRECISION* sigma_t,
+                                        FP_PRECISION length, int p,
+                                        FP_PRECISION* exponentials) {
+
+  int num_active_cases = _num_active_cases;
+
+  /* Evaluate the exponentials using the lookup table */
+  if (_interpolate_exponential) {
+    for (int c=0; c < num_active_cases; c++) {
+      FP_PRECISION tau = sigma_t[c] * length;
+      int index = round_to_int(tau * _inverse_exp_table_spacing) *
+                  _two_times_num_polar;
+      exponentials[c] = (1. - (_exp_table[index + 2 * p] * tau +
+                               _exp_table[index + 2 * p + 1]));
+    }
+  }
+
+  /* Evaluate the exponentials using the polynomial */
+  else if (_polynomial_exponential) {
+    FP_PRECISION inverse_sintheta = 1. / _quad->getSinTheta(p);
+
+    #pragma omp simd
+    for (int c=0; c < num_active_cases; c++)
+      exponentials[c] = exponential_poly(sigma_t[c] * length *
+                                         inverse_sintheta,
+                                         _exp_poly_coefficients,
+                                         _exp_poly_degree);
+  }
+
+  /* Evalute the exponentials using the intrinsic exp(...) function */
+  else {
+    FP_PRECISION inverse_sintheta = 1. / _quad->getSinTheta(p);
+
+    #pragma omp simd
+    for (int c=0; c < num_active_cases; c++)
+      exponentials[c] = 1.0 - exp(- sigma_t[c] * length * inverse_sintheta);
+  }
+}
+
+
+/**
+ * @brief Computes the contribution to the FSR scalar flux from a Track
+ *        segment for each case which has not yet converged.
+ * @details The segment and its FSR's Material are loaded once for all of
+ *          the cases, and the loops over the cases are vectorized.
+ * @param curr_segment a pointer to the Track segment of interest
+ * @param azim_index the azimuthal angle index for this segment
+ * @param track_flux a pointer to the Track's angular flux for each case
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ */
+void BatchedSolver::scalarFluxTally(segment* curr_segment, int azim_index,
+                                    FP_PRECISION* track_flux,
+                                    FP_PRECISION* fsr_flux) {
+
+  int num_active_cases = _num_active_cases;
+  int fsr_id = curr_segment->_region_id;
+  int m = _FSR_material_indices[fsr_id];
+  FP_PRECISION length = curr_segment->_length;
+  FP_PRECISION* polar_weights = &_polar_weights(azim_index,0);
+  FP_PRECISION* exponentials =
+       &_thread_exponentials[omp_get_thread_num() * _num_cases];
+
+  /* Loop over energy groups */
+  for (int e=0; e < _num_groups; e++) {
+
+    FP_PRECISION* sigma_t = &_batched_xs(_batched_sigma_t,m,e,0);
+    FP_PRECISION* reduced_source = &_batched_reduced_source(fsr_id,e,0);
+    FP_PRECISION* group_flux = &fsr_flux[e*_num_cases];
+
+    /* Loop over polar angles */
+    for (int p=0; p < _num_polar; p++) {
+
+      FP_PRECISION* psi = &track_flux[(p*_num_groups + e) * _num_cases];
+      FP_PRECISION polar_weight = polar_weights[p];
+
+      computeExponentials(sigma_t, length, p, exponentials);
+
+      /* Loop over cases */
+      #pragma omp simd
+      for (int c=0; c < num_active_cases; c++) {
+        FP_PRECISION delta_psi = (psi[c] - reduced_source[c]) *
+                                 exponentials[c];
+        group_flux[c] += delta_psi * polar_weight;
+        psi[c] -= delta_psi;
+      }
+    }
+  }
+}
+
+
+/**
+ * @brief Updates the boundary flux of each case which has not yet converged
+ *        for a Track given boundary conditions.
+ * @param track_id the ID number for the Track of interest
+ * @param azim_index the azimuthal angle index for this Track
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @param track_flux a pointer to the Track's outgoing angular flux
+ */
+void BatchedSolver::transferBoundaryFlux(int track_id, int azim_index,
+                                         bool direction,
+                                         FP_PRECISION* track_flux) {
+
+  int num_active_cases = _num_active_cases;
+  int start;
+  int bc;
+  int track_out_id;
+  int leakage_start;
+  FP_PRECISION* polar_weights = &_polar_weights(azim_index,0);
+
+  /* For the "forward" direction */
+  if (direction) {
+    start = _tracks[track_id]->isReflOut();
+    bc = (int)_tracks[track_id]->getBCOut();
+    track_out_id = _tracks[track_id]->getTrackOut()->getUid();
+    leakage_start = 0;
+  }
+
+  /* For the "reverse" direction */
+  else {
+    start = _tracks[track_id]->isReflIn();
+    bc = (int)_tracks[track_id]->getBCIn();
+    track_out_id = _tracks[track_id]->getTrackIn()->getUid();
+    leakage_start = _polar_times_groups;
+  }
+
+  FP_PRECISION* track_out_flux =
+       &_batched_boundary_flux(track_out_id,start,0,0);
+
+  /* Loop over polar angles, energy groups and cases */
+  for (int p=0; p < _num_polar; p++) {
+    for (int e=0; e < _num_groups; e++) {
+
+      int pe = p*_num_groups + e;
+
+      for (int c=0; c < num_active_cases; c++) {
+        FP_PRECISION psi = track_flux[pe*_num_cases + c];
+        track_out_flux[pe*_num_cases + c] = psi * bc;
+        _batched_boundary_leakage(c,track_id,leakage_start+pe) =
+             psi * polar_weights[p] * (!bc);
+      }
+    }
+  }
+}
+
+
+/**
+ * @brief Integrates the angular flux of each case which has not yet
+ *        converged along a Track in the forward and reverse directions.
+ * @param track_id the ID number for the Track of interest
+ */
+void BatchedSolver::sweepTrack(int track_id) {
+
+  int tid = omp_get_thread_num();
+  Track* curr_track = _tracks[track_id];
+  int azim_index = curr_track->getAzimAngleIndex();
+  int num_segments = curr_track->getNumSegments();
+  segment* segments = curr_track->getSegments();
+  FP_PRECISION* fsr_flux = &_thread_fsr_flux[tid*_num_groups*_num_cases];
+  FP_PRECISION* track_flux;
+
+  if (num_segments == 0)
+    return;
+
+  int fsr_id = segments[0]._region_id;
+
+  /* Loop over each Track segment in forward direction */
+  track_flux = &_batched_boundary_flux(track_id,0,0,0);
+
+  for (int s=0; s < num_segments; s++) {
+    if (segments[s]._region_id != fsr_id) {
+      accumulateScalarFlux(fsr_id, fsr_flux);
+      fsr_id = segments[s]._region_id;
+    }
+
+    scalarFluxTally(&segments[s], azim_index, track_flux, fsr_flux);
+  }
+
+  /* Transfer boundary angular flux to outgoing Track */
+  transferBoundaryFlux(track_id, azim_index, true, track_flux);
+
+  /* Loop over each Track segment in reverse direction */
+  track_flux = &_batched_boundary_flux(track_id,1,0,0);
+
+  for (int s=num_segments-1; s > -1; s--) {
+    if (segments[s]._region_id != fsr_id) {
+      accumulateScalarFlux(fsr_id, fsr_flux);
+      fsr_id = segments[s]._region_id;
+    }
+
+    scalarFluxTally(&segments[s], azim_index, track_flux, fsr_flux);
+  }
+
+  /* Flush the last FSR along the Track to the global scalar flux */
+  accumulateScalarFlux(fsr_id, fsr_flux);
+
+  /* Transfer boundary angular flux to outgoing Track */
+  transferBoundaryFlux(track_id, azim_index, false, track_flux);
+}
+
+
+/**
+ * @brief Flushes a thread's temporary FSR scalar flux buffer for each case
+ *        to the global FSR scalar flux and zeroes the buffer.
+ * @param fsr_id the ID for the FSR of interest
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ */
+void BatchedSolver::accumulateScalarFlux(int fsr_id, FP_PRECISION* fsr_flux) {
+
+  int num_active_cases = _num_active_cases;
+
+  /* Atomically increment each energy group and case without any locks */
+  if (_accumulation_type == ATOMICS) {
+    for (int e=0; e < _num_groups; e++) {
+      for (int c=0; c < num_active_cases; c++) {
+        #pragma omp atomic
+        _batched_scalar_flux(fsr_id,e,c) += fsr_flux[e*_num_cases+c];
+        fsr_flux[e*_num_cases+c] = 0.0;
+      }
+    }
+  }
+
+  /* Increment the FSR scalar flux using the FSR's (or FSR stripe's) lock */
+  else {
+    omp_lock_t* lock = &_FSR_locks[fsr_id % _num_FSR_locks];
+
+    omp_set_lock(lock);
+
+    for (int e=0; e < _num_groups; e++) {
+      FP_PRECISION* scalar_flux = &_batched_scalar_flux(fsr_id,e,0);
+
+      #pragma omp simd
+      for (int c=0; c < num_active_cases; c++)
+        scalar_flux[c] += fsr_flux[e*_num_cases+c];
+    }
+
+    omp_unset_lock(lock);
+
+    memset(fsr_flux, 0, _num_groups * _num_cases * sizeof(FP_PRECISION));
+  }
+}
+
+
+/**
+ * @brief Add the source term contribution in the transport equation to
+ *        the FSR scalar flux of each case which has not yet converged.
+ */
+void BatchedSolver::addSourceToScalarFlux() {
+
+  int num_active_cases = _num_active_cases;
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    int m = _FSR_material_indices[r];
+    FP_PRECISION volume = _FSR_volumes[r];
+
+    for (int e=0; e < _num_groups; e++) {
+      FP_PRECISION* scalar_flux = &_batched_scalar_flux(r,e,0);
+      FP_PRECISION* reduced_source = &_batched_reduced_source(r,e,0);
+      FP_PRECISION* sigma_t = &_batched_xs(_batched_sigma_t,m,e,0);
+
+      #pragma omp simd
+      for (int c=0; c < num_active_cases; c++)
+        scalar_flux[c] = FOUR_PI * reduced_source[c] +
+                         (0.5 * scalar_flux[c] / (sigma_t[c] * volume));
+    }
+
+    tallyFSRRates(r);
+  }
+
+  _FSR_rates_tallied = true;
+
+  return;
+}
+
+
+/**
+ * @brief Performs one transport sweep of all Tracks for each case which has
+ *        not yet converged.
+ * @details The Tracks in each azimuthal angle halfspace are swept
+ *          concurrently as for the HALFSPACE_SWEEP sweep type.
+ */
+void BatchedSolver::transportSweep() {
+
+  int num_active_cases = _num_active_cases;
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
+
+  /* Zero the scalar fluxes of the cases which have not yet converged */
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++) {
+      for (int c=0; c < num_active_cases; c++)
+        _batched_scalar_flux(r,e,c) = 0.0;
+    }
+  }
+
+  /* Loop over azimuthal angle halfspaces */
+  for (int i=0; i < 2; i++) {
+
+    int min_track = i * (_tot_num_tracks / 2);
+    int max_track = (i + 1) * (_tot_num_tracks / 2);
+
+    #pragma omp parallel for schedule(guided)
+    for (int t=min_track; t < max_track; t++)
+      sweepTrack((sorted_tracks != NULL) ? sorted_tracks[t] : t);
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Stops sweeping a case which has converged by swapping it with the
+ *        last case which has not yet converged.
+ * @param lane the lane of the case which has converged
+ */
+void BatchedSolver::deactivateCase(int lane) {
+  _num_active_cases--;
+  swapLanes(lane, _num_active_cases);
+}
+
+
+/**
+ * @brief Swaps the fluxes, sources, cross-sections and rates of two lanes.
+ * @param lane1 the first lane
+ * @param lane2 the second lane
+ */
+void BatchedSolver::swapLanes(int lane1, int lane2) {
+
+  if (lane1 == lane2)
+    return;
+
+  /* The arrays with the case as the innermost index */
+  long xs_size = (long)_num_batched_materials * _num_groups;
+  long flux_size = (long)_num_FSRs * _num_groups;
+
+  FP_PRECISION* arrays[11] = {_scalar_flux, _source, _old_source,
+                              _reduced_source, _boundary_flux,
+                              _batched_sigma_t, _batched_sigma_a,
+                              _batched_sigma_f, _batched_nu_sigma_f,
+                              _batched_chi, _batched_sigma_s};
+  long sizes[11] = {flux_size, flux_size, flux_size, flux_size,
+                    2 * (long)_tot_num_tracks * _polar_times_groups,
+                    xs_size, xs_size, xs_size, xs_size, xs_size,
+                    xs_size * _num_groups};
+
+  for (int a=0; a < 11; a++) {
+    FP_PRECISION* array = arrays[a];
+
+    #pragma omp parallel for schedule(guided)
+    for (long i=0; i < sizes[a]; i++)
+      std::swap(array[i*_num_cases+lane1], array[i*_num_cases+lane2]);
+  }
+
+  /* The arrays with all FSRs or Tracks of each lane in turn */
+  long leakage_size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+
+  std::swap_ranges(&_FSR_fission_rates[(long)lane1*_num_FSRs],
+                   &_FSR_fission_rates[(long)(lane1+1)*_num_FSRs],
+                   &_FSR_fission_rates[(long)lane2*_num_FSRs]);
+  std::swap_ranges(&_FSR_absorption_rates[(long)lane1*_num_FSRs],
+                   &_FSR_absorption_rates[(long)(lane1+1)*_num_FSRs],
+                   &_FSR_absorption_rates[(long)lane2*_num_FSRs]);
+  std::swap_ranges(&_boundary_leakage[lane1*leakage_size],
+                   &_boundary_leakage[(lane1+1)*leakage_size],
+                   &_boundary_leakage[lane2*leakage_size]);
+
+  std::swap(_lane_norm_factors[lane1], _lane_norm_factors[lane2]);
+
+  /* Swap the cases in the lanes */
+  std::swap(_lane_cases[lane1], _lane_cases[lane2]);
+  _case_lanes[_lane_cases[lane1]] = lane1;
+  _case_lanes[_lane_cases[lane2]] = lane2;
+}
+
+
+/**
+ * @brief Computes keff for each case by performing a series of transport
+ *        sweeps and source updates for all cases together.
+ * @details Each case converges when the residual of its own source falls
+ *          below the convergence threshold, after which it is no longer
+ *          swept. The eigenvalue of the first case is returned, and that of
+ *          each case may be retrieved from Python as follows:
+ *
+ * @code
+ *          solver.convergeSource(max_iters)
+ *          keffs = [solver.getCaseKeff(i) for i in range(num_cases)]
+ * @endcode
+ *
+ * @param max_iterations the maximum number of source iterations to allow
+ * @return the value of the computed eigenvalue \f$ k_{eff} \f$ of the first
+ *         case
+ */
+FP_PRECISION BatchedSolver::convergeSource(int max_iterations) {
+
+  /* Error checking */
+  if (_geometry == NULL)
+    log_printf(ERROR, "The Solver is unable to converge the source "
+               "since it does not contain a Geometry");
+
+  if (_track_generator == NULL)
+    log_printf(ERROR, "The Solver is unable to converge the source "
+               "since it does not contain a TrackGenerator");
+
+  if (_sweep_type != HALFSPACE_SWEEP)
+    log_printf(ERROR, "The BatchedSolver is unable to converge the source "
+               "with a sweep type other than HALFSPACE_SWEEP");
+
+  if (_exp_cache_max_memory > 0.)
+    log_printf(ERROR, "The BatchedSolver is unable to converge the source "
+               "with an exponential cache");
+
+  if (_checkpoint_interval > 0 || !_restart_file.empty())
+    log_printf(ERROR, "The BatchedSolver is unable to write or restart "
+               "from checkpoints");
+
+  if (_persistent_parallel_region)
+    log_printf(ERROR, "The BatchedSolver is unable to converge the source "
+               "in a persistent parallel region");
+
+  log_printf(NORMAL, "Converging the source for %d cases...", _num_cases);
+
+  clearTimerSplits();
+  _timer->startTimer();
+
+  _num_iterations = 0;
+
+  /* Initialize data structures, with the cross-sections of each case
+   * gathered before the exponential table is sized for them */
+  initializePolarQuadrature();
+  initializeFluxArrays();
+  initializeSourceArrays();
+  initializeFSRs();
+  buildExpInterpTable();
+  initializeCmfd();
+
+  if (_cmfd->getMesh()->getCmfdOn())
+    log_printf(ERROR, "The BatchedSolver is unable to converge the source "
+               "with CMFD");
+
+  /* Check that each FSR has at least one segment crossing it */
+  checkTrackSpacing();
+
+  /* Record the cross-sections for which the sources are converged */
+  recordCaseMaterialFingerprints();
+
+  /* Set scalar flux to unity for each region */
+  flattenFSRFluxes(1.0);
+  flattenFSRSources(1.0);
+  zeroTrackFluxes();
+
+  iterateCases(max_iterations);
+
+  _timer->stopTimer();
+  _timer->recordSplit("Total time to converge the source");
+
+  return _k_eff;
+}
+
+
+/**
+ * @brief Recomputes keff for each case after the cross-sections of some
+ *        Materials have changed since the sources were last converged.
+ * @details The cross-sections of each case are gathered again only for the
+ *          Materials which have changed, either in the Geometry or replacing
+ *          one of its Materials for a case. Every case is then swept again,
+ *          warm started from its previous fluxes, sources and eigenvalue.
+ *          The number of cases, the Geometry and the Tracks must not have
+ *          changed. This may be called from Python as follows:
+ *
+ * @code
+ *          solver.convergeSource(max_iters)
+ *          perturbed_fuel.setSigmaA(perturbed_sigma_a)
+ *          solver.resolve(max_iters)
+ *          keffs = [solver.getCaseKeff(i) for i in range(num_cases)]
+ * @endcode
+ *
+ * @param max_iterations the maximum number of source iterations to allow
+ * @return the value of the computed eigenvalue \f$ k_{eff} \f$ of the first
+ *         case
+ */
+FP_PRECISION BatchedSolver::resolve(int max_iterations) {
+
+  /* Converge the sources from scratch if they were not converged before,
+   * or if the number of cases has changed since */
+  if (_material_fingerprints.empty() || _case_k_eff == NULL)
+    return convergeSource(max_iterations);
+
+  log_printf(NORMAL, "Reconverging the source for %d cases...", _num_cases);
+
+  clearTimerSplits();
+  _timer->startTimer();
+
+  /* Find the Materials whose cross-sections have changed, including any
+   * Materials replacing them which were set since */
+  std::vector<Material*> materials;
+  std::map<int, Material*> all_materials = _geometry->getMaterials();
+  std::map<int, Material*>::iterator iter;
+
+  for (int c=-1; c < _num_cases; c++) {
+    std::map<int, Material*>& case_materials =
+         (c < 0) ? all_materials : _case_materials[c];
+
+    for (iter=case_materials.begin(); iter != case_materials.end(); ++iter) {
+      Material* material = iter->second;
+      std::map<int, uint64_t>::iterator fingerprint =
+           _material_fingerprints.find(material->getUid());
+
+      if (fingerprint == _material_fingerprints.end() ||
+          computeMaterialFingerprint(material) != fingerprint->second)
+        materials.push_back(material);
+    }
+  }
+
+  log_printf(INFO, "The cross-sections of %d Materials have changed",
+             (int)materials.size());
+
+  if (!materials.empty()) {
+    updateMaterials(materials);
+    recordCaseMaterialFingerprints();
+  }
+
+  /* Sweep every case again from its current lane */
+  _num_iterations = 0;
+  _num_active_cases = _num_cases;
+
+  for (int c=0; c < _num_cases; c++)
+    _case_num_iterations[c] = 0;
+
+  iterateCases(max_iterations);
+
+  _timer->stopTimer();
+  _timer->recordSplit("Total time to converge the source");
+
+  return _k_eff;
+}
+
+
+/**
+ * @brief Performs source iterations for the active cases from their current
+ *        fluxes, sources and eigenvalues until each of their sources
+ *        converges.
+ * @details This method is for internal use only and is called by the
+ *          BatchedSolver::convergeSource() and BatchedSolver::resolve()
+ *          methods.
+ * @param max_iterations the maximum number of source iterations to allow
+ */
+void BatchedSolver::iterateCases(int max_iterations) {
+
+  /* Source iteration loop */
+  for (int i=0; i < max_iterations; i++) {
+
+    log_printf(NORMAL, "Iteration %d: \t%d cases remaining", i,
+               _num_active_cases);
+
+    normalizeFluxes();
+    computeFSRSources();
+    transportSweep();
+    addSourceToScalarFlux();
+    computeKeff();
+
+    _num_iterations++;
+
+    /* Stop sweeping the cases whose sources have converged, from the last
+     * lane such that the remaining lanes are not reordered */
+    for (int c=_num_active_cases-1; c >= 0; c--) {
+      int case_id = _lane_cases[c];
+      _case_num_iterations[case_id]++;
+
+      if (i > 1 && _case_residuals[case_id] < _source_convergence_thresh)
+        deactivateCase(c);
+    }
+
+    if (_num_active_cases == 0)
+      break;
+  }
+
+  if (_num_active_cases > 0)
+    log_printf(WARNING, "Unable to converge the source of %d cases after %d "
+               "iterations", _num_active_cases, max_iterations);
+
+  _k_eff = _case_k_eff[0];
+}
+
+
+/**
+ * @brief Computes the volume-weighted, energy integrated fission rate in
+ *        each FSR for the first case.
+ * @param fission_rates an array to store the fission rates (implicitly passed
+ *                      in as a NumPy array from Python)
+ * @param num_FSRs the number of FSRs passed in from Python
+ */
+void BatchedSolver::computeFSRFissionRates(double* fission_rates,
+                                           int num_FSRs) {
+  computeCaseFSRFissionRates(0, fission_rates, num_FSRs);
+}
+
+
+/**
+ * @brief Computes the volume-weighted, energy integrated fission rate in
+ *        each FSR for a case and stores them in an array indexed by FSR ID.
+ * @details This is a helper method for SWIG to allow users to retrieve
+ *          FSR fission rates as a NumPy array:
+ *
+ * @code
+ *          num_FSRs = geometry.getNumFSRs()
+ *          fission_rates = solver.computeCaseFSRFissionRates(1, num_FSRs)
+ * @endcode
+ *
+ * @param case_id the case of interest
+ * @param fission_rates an array to store the fission rates (implicitly passed
+ *                      in as a NumPy array from Python)
+ * @param num_FSRs the number of FSRs passed in from Python
+ */
+void BatchedSolver::computeCaseFSRFissionRates(int case_id,
+                                               double* fission_rates,
+                                               int num_FSRs) {
+
+  if (case_id < 0 || case_id >= _num_cases)
+    log_printf(ERROR, "Unable to compute the fission rates for case %d "
+               "since the Solver has %d cases", case_id, _num_cases);
+
+  log_printf(INFO, "Computing FSR fission rates...");
+
+  int lane = _case_lanes[case_id];
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    int m = _FSR_material_indices[r];
+    FP_PRECISION fission_rate = 0.;
+
+    for (int e=0; e < _num_groups; e++)
+      fission_rate += _batched_xs(_batched_sigma_f,m,e,lane) *
+                      _batched_scalar_flux(r,e,lane);
+
+    fission_rates[_geometry->getFSRId(r)] = fission_rate;
+  }
+}
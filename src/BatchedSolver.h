@@ -0,0 +1,189 @@
+/**
+ * @file BatchedSolver.h
+ * @brief The BatchedSolver class.
+ * @date October 17, 2026
+ */
+
+
+#ifndef BATCHEDSOLVER_H_
+#define BATCHEDSOLVER_H_
+
+#ifdef __cplusplus
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <omp.h>
+#include <stdlib.h>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include "CPUSolver.h"
+#endif
+
+/** Indexing macro for the scalar flux in each FSR, energy group and case */
+#define _batched_scalar_flux(r,e,c) (_scalar_flux[((r)*_num_groups + (e))*_num_cases + (c)])
+
+/** Indexing macro for the source in each FSR, energy group and case */
+#define _batched_source(r,e,c) (_source[((r)*_num_groups + (e))*_num_cases + (c)])
+
+/** Indexing macro for the source from the previous source iteration in each
+ *  FSR, energy group and case */
+#define _batched_old_source(r,e,c) (_old_source[((r)*_num_groups + (e))*_num_cases + (c)])
+
+/** Indexing macro for the source divided by the total cross-section in each
+ *  FSR, energy group and case */
+#define _batched_reduced_source(r,e,c) (_reduced_source[((r)*_num_groups + (e))*_num_cases + (c)])
+
+/** Indexing macro for the angular fluxes for each polar angle and energy
+ *  group (pe) and case in both directions for a given Track */
+#define _batched_boundary_flux(i,j,pe,c) (_boundary_flux[(((i)*2 + (j))*_polar_times_groups + (pe))*_num_cases + (c)])
+
+/** Indexing macro for the leakage for each case, Track, and polar angle and
+ *  energy group (pe2) in both directions */
+#define _batched_boundary_leakage(c,i,pe2) (_boundary_leakage[((long)(c)*_tot_num_tracks + (i))*2*_polar_times_groups + (pe2)])
+
+/** Indexing macro for a cross-section in each Material, energy group and
+ *  case */
+#define _batched_xs(xs,m,e,c) (xs[((m)*_num_groups + (e))*_num_cases + (c)])
+
+/** Indexing macro for the scattering cross-section from group g to group G
+ *  in each Material and case */
+#define _batched_sigma_s(m,G,g,c) (_batched_sigma_s[(((m)*_num_groups + (G))*_num_groups + (g))*_num_cases + (c)])
+
+
+/**
+ * @class BatchedSolver BatchedSolver.h "src/BatchedSolver.h"
+ * @brief This is a subclass of the CPUSolver which converges the source for
+ *        several cases with different cross-sections in the same transport
+ *        sweeps.
+ * @details Each case may replace any of the Geometry's Materials by another
+ *          Material with perturbed cross-sections. The case is the innermost
+ *          index of the flux, source and cross-section arrays, such that
+ *          each Track segment and its FSR are loaded once for all of the
+ *          cases and the loops over cases are vectorized. The eigenvalue
+ *          and source residual of each case are tracked independently, and
+ *          once a case has converged, it is swapped behind the cases which
+ *          have not yet converged and it is no longer swept. Only the
+ *          HALFSPACE_SWEEP sweep type is supported, without CMFD
+ *          acceleration, the exponential cache or single precision
+ *          boundary fluxes.
+ */
+class BatchedSolver : public CPUSolver {
+
+protected:
+
+  /** The number of cases */
+  int _num_cases;
+
+  /** The number of cases which have not yet converged */
+  int _num_active_cases;
+
+  /** The Materials replacing each Material ID for each case */
+  std::vector< std::map<int, Material*> > _case_materials;
+
+  /** The case in each position (lane) of the innermost index of the arrays,
+   *  with the cases which have not yet converged first */
+  int* _lane_cases;
+
+  /** The lane of each case */
+  int* _case_lanes;
+
+  /** The eigenvalue for each case */
+  FP_PRECISION* _case_k_eff;
+
+  /** The source residual for each case */
+  FP_PRECISION* _case_residuals;
+
+  /** The number of source iterations for each case to converge */
+  int* _case_num_iterations;
+
+  /** The number of Materials filling the FSRs */
+  int _num_batched_materials;
+
+  /** The index of the Material filling each FSR */
+  int* _FSR_material_indices;
+
+  /** The total cross-sections for each Material, energy group and lane */
+  FP_PRECISION* _batched_sigma_t;
+
+  /** The absorption cross-sections for each Material, energy group and
+   *  lane */
+  FP_PRECISION* _batched_sigma_a;
+
+  /** The scattering matrix for each Material, pair of energy groups and
+   *  lane */
+  FP_PRECISION* _batched_sigma_s;
+
+  /** The fission cross-sections for each Material, energy group and lane */
+  FP_PRECISION* _batched_sigma_f;
+
+  /** The fission cross-sections times \f$ \nu \f$ for each Material,
+   *  energy group and lane */
+  FP_PRECISION* _batched_nu_sigma_f;
+
+  /** The fission spectrum for each Material, energy group and lane */
+  FP_PRECISION* _batched_chi;
+
+  /** The normalization factor for the scalar fluxes in each lane */
+  FP_PRECISION* _lane_norm_factors;
+
+  /** A buffer for the exponentials of each lane for each thread */
+  FP_PRECISION* _thread_exponentials;
+
+  void initializeFluxArrays();
+  void initializeSourceArrays();
+  void initializeFSRs();
+  void initializeCases();
+  void gatherCaseMaterials(int m, Material* material);
+  void updateMaterials(std::vector<Material*>& materials);
+  void recordCaseMaterialFingerprints();
+  void deleteBatchedMaterials();
+  FP_PRECISION getMaxOpticalLength();
+
+  void zeroTrackFluxes();
+  void flattenFSRFluxes(FP_PRECISION value);
+  void flattenFSRSources(FP_PRECISION value);
+  void tallyFSRRates(int fsr_id);
+  void normalizeFluxes();
+  FP_PRECISION computeFSRSources();
+  void computeExponentials(FP_PRECISION* sigma_t, FP_PRECISION length,
+                           int p, FP_PRECISION* exponentials);
+  void scalarFluxTally(segment* curr_segment, int azim_index,
+                       FP_PRECISION* track_flux, FP_PRECISION* fsr_flux);
+  void transferBoundaryFlux(int track_id, int azim_index, bool direction,
+                            FP_PRECISION* track_flux);
+  void sweepTrack(int track_id);
+  void accumulateScalarFlux(int fsr_id, FP_PRECISION* fsr_flux);
+  void addSourceToScalarFlux();
+  void computeKeff();
+  void transportSweep();
+  void deactivateCase(int lane);
+  void swapLanes(int lane1, int lane2);
+  void iterateCases(int max_iterations);
+
+public:
+  BatchedSolver(Geometry* geometry=NULL, TrackGenerator* track_generator=NULL,
+                Cmfd* cmfd=NULL);
+  virtual ~BatchedSolver();
+
+  int getNumCases();
+  FP_PRECISION getCaseKeff(int case_id);
+  int getCaseNumIterations(int case_id);
+  FP_PRECISION getCaseFSRScalarFlux(int case_id, int fsr_id,
+                                    int energy_group);
+  FP_PRECISION getFSRScalarFlux(int fsr_id, int energy_group);
+  FP_PRECISION getFSRSource(int fsr_id, int energy_group);
+
+  void setNumCases(int num_cases);
+  void setCaseMaterial(int case_id, int material_id, Material* material);
+
+  FP_PRECISION convergeSource(int max_iterations);
+  FP_PRECISION resolve(int max_iterations);
+
+  void computeFSRFissionRates(double* fission_rates, int num_FSRs);
+  void computeCaseFSRFissionRates(int case_id, double* fission_rates,
+                                  int num_FSRs);
+};
+
+
+#endif /* BATCHEDSOLVER_H_ */
@@ -14,11 +14,51 @@
 CPUSolver::CPUSolver(Geometry* geometry, TrackGenerator* track_generator,
                      Cmfd* cmfd) : Solver(geometry, track_generator, cmfd) {
 
+  _thread_affinity = AFFINITY_NONE;
+  _page_placement = FIRST_TOUCH;
+  _huge_pages = NO_HUGE_PAGES;
   setNumThreads(1);
 
+  _accumulation_type = LOCKS;
+  _sweep_type = HALFSPACE_SWEEP;
+  _num_lock_stripes = 1024;
+  _num_FSR_locks = 0;
+  _num_mesh_surface_locks = 0;
+
   _FSR_locks = NULL;
   _mesh_surface_locks = NULL;
   _thread_fsr_flux = NULL;
+
+  _exp_cache_max_memory = 0.;
+  _exp_cache_single_precision = false;
+  _first_segment = NULL;
+  _num_cached_segments = 0;
+  _exp_cache = NULL;
+  _float_exp_cache = NULL;
+  _thread_exp_buffer = NULL;
+
+  _boundary_flux_single_precision = false;
+  _float_boundary_flux = NULL;
+  _thread_track_flux = NULL;
+
+  _num_source_blocks = 0;
+  _source_block_offsets = NULL;
+  _material_FSRs = NULL;
+
+  _FSR_fission_rates = NULL;
+  _FSR_absorption_rates = NULL;
+  _thread_group_rates = NULL;
+  _FSR_rates_tallied = false;
+  _flux_norm_factor = 1.0;
+
+  _num_track_dependencies = NULL;
+  _track_dependencies = NULL;
+
+  _persistent_parallel_region = false;
+  _in_parallel_region = false;
+
+  _scalar_flux_kernel = &CPUSolver::scalarFluxTallyKernel<0,0>;
+  _boundary_flux_kernel = &CPUSolver::transferBoundaryFluxKernel<0,0>;
 }
 
 
@@ -29,17 +69,59 @@ CPUSolver::CPUSolver(Geometry* geometry, TrackGenerator* track_generator,
  */
 CPUSolver::~CPUSolver() {
 
-  if (_FSR_locks != NULL)
+  if (_FSR_locks != NULL) {
+    for (int i=0; i < _num_FSR_locks; i++)
+      omp_destroy_lock(&_FSR_locks[i]);
+
     delete [] _FSR_locks;
+  }
+
+  if (_mesh_surface_locks != NULL) {
+    for (int i=0; i < _num_mesh_surface_locks; i++)
+      omp_destroy_lock(&_mesh_surface_locks[i]);
 
-  if (_mesh_surface_locks != NULL)
     delete [] _mesh_surface_locks;
+  }
 
   if (_thread_fsr_flux != NULL)
     delete [] _thread_fsr_flux;
 
+  /* The boundary flux and leakage arrays are deleted here rather than by
+   * the Solver since they are allocated with huge_page_malloc(...) */
+  huge_page_free(_boundary_flux);
+  huge_page_free(_float_boundary_flux);
+  huge_page_free(_boundary_leakage);
+  _boundary_flux = NULL;
+  _boundary_leakage = NULL;
+
+  if (_thread_track_flux != NULL)
+    delete [] _thread_track_flux;
+
   if (_surface_currents != NULL)
     delete [] _surface_currents;
+
+  if (_source_block_offsets != NULL)
+    delete [] _source_block_offsets;
+
+  if (_material_FSRs != NULL)
+    delete [] _material_FSRs;
+
+  if (_FSR_fission_rates != NULL)
+    delete [] _FSR_fission_rates;
+
+  if (_FSR_absorption_rates != NULL)
+    delete [] _FSR_absorption_rates;
+
+  if (_thread_group_rates != NULL)
+    delete [] _thread_group_rates;
+
+  if (_num_track_dependencies != NULL)
+    delete [] _num_track_dependencies;
+
+  if (_track_dependencies != NULL)
+    delete [] _track_dependencies;
+
+  deleteExponentialCache();
 }
 
 
@@ -52,6 +134,97 @@ int CPUSolver::getNumThreads() {
 }
 
 
+/**
+ * @brief Returns the pinning of the OpenMP threads to cores.
+ * @return the thread affinity (AFFINITY_NONE, AFFINITY_COMPACT or
+ *         AFFINITY_SCATTER)
+ */
+threadAffinity CPUSolver::getThreadAffinity() {
+  return _thread_affinity;
+}
+
+
+/**
+ * @brief Returns the placement of the pages of the flux and source arrays
+ *        on NUMA nodes.
+ * @return the page placement (FIRST_TOUCH or INTERLEAVED)
+ */
+pagePlacement CPUSolver::getPagePlacement() {
+  return _page_placement;
+}
+
+
+/**
+ * @brief Returns the pages backing the Track boundary flux and leakage
+ *        arrays.
+ * @return the huge pages requested for the boundary fluxes
+ */
+hugePageType CPUSolver::getHugePages() {
+  return _huge_pages;
+}
+
+
+/**
+ * @brief Returns the scheme used to accumulate FSR scalar fluxes and Cmfd
+ *        Mesh surface currents during each transport sweep.
+ * @return the flux accumulation scheme (LOCKS, STRIPED_LOCKS or ATOMICS)
+ */
+fluxAccumulationType CPUSolver::getFluxAccumulationType() {
+  return _accumulation_type;
+}
+
+
+/**
+ * @brief Returns the scheme used to schedule Tracks on threads during each
+ *        transport sweep.
+ * @return the sweep type (HALFSPACE_SWEEP, COLORED_SWEEP, PIPELINED_SWEEP
+ *         or PARTITIONED_SWEEP)
+ */
+sweepType CPUSolver::getSweepType() {
+  return _sweep_type;
+}
+
+
+/**
+ * @brief Returns whether each source iteration runs in a single parallel
+ *        region.
+ * @return true if the parallel region persists for the source iteration;
+ *         false otherwise
+ */
+bool CPUSolver::isUsingPersistentParallelRegion() {
+  return _persistent_parallel_region;
+}
+
+
+/**
+ * @brief Returns the number of locks shared by all FSRs (or Mesh surfaces)
+ *        when accumulating fluxes with STRIPED_LOCKS.
+ * @return the number of lock stripes
+ */
+int CPUSolver::getNumLockStripes() {
+  return _num_lock_stripes;
+}
+
+
+/**
+ * @brief Returns the maximum memory for the per-segment exponential cache.
+ * @return the maximum exponential cache size (MB)
+ */
+double CPUSolver::getExponentialCacheSize() {
+  return _exp_cache_max_memory;
+}
+
+
+/**
+ * @brief Returns the number of Track segments whose exponentials were
+ *        cached for the most recent source convergence.
+ * @return the number of cached segments
+ */
+long CPUSolver::getNumCachedSegments() {
+  return _num_cached_segments;
+}
+
+
 /**
  * @brief Returns the scalar flux for some FSR and energy group.
  * @param fsr_id the ID for the FSR of interest
@@ -81,7 +254,7 @@ FP_PRECISION CPUSolver::getFSRScalarFlux(int fsr_id, int energy_group) {
                "in energy group %d since energy groups are greater than "
                "or equal to 1", fsr_id, energy_group);
 
-  return _scalar_flux(fsr_id,energy_group-1);
+  return _scalar_flux(_geometry->getInternalFSRId(fsr_id),energy_group-1);
 }
 
 
@@ -114,14 +287,15 @@ FP_PRECISION CPUSolver::getFSRSource(int fsr_id, int energy_group) {
                "in energy group %d since energy groups are greater than "
                "or equal to 1", fsr_id, energy_group);
 
-  return _source(fsr_id,energy_group-1);
+  return _source(_geometry->getInternalFSRId(fsr_id),energy_group-1);
 }
 
 
 /**
  * @brief Return a scalar flux array indexed by FSR IDs and energy groups.
  * @details This energy groups are the innermost index, while the FSR ID is
- *         the outermost index.
+ *         the outermost index. The array is indexed by the internal FSR IDs
+ *         if the FSRs have been renumbered by the Geometry.
  * @return an array of flat source region scalar fluxes
  */
 FP_PRECISION* CPUSolver::getFSRScalarFluxes() {
@@ -151,9 +325,22 @@ double* CPUSolver::getSurfaceCurrents() {
 
 /**
  * @brief Sets the number of shared memory OpenMP threads to use (>0).
+ * @details The threads may also be pinned to cores, such that each thread
+ *          stays on the NUMA node holding the pages it first touched. With
+ *          AFFINITY_COMPACT, the threads fill the cores of each NUMA node
+ *          in turn, while with AFFINITY_SCATTER, consecutive threads
+ *          alternate between the NUMA nodes. The threads may be pinned from
+ *          Python as follows:
+ *
+ * @code
+ *          solver.setNumThreads(16, openmoc.AFFINITY_COMPACT)
+ * @endcode
+ *
  * @param num_threads the number of threads
+ * @param affinity the pinning of the threads to cores (AFFINITY_NONE by
+ *        default)
  */
-void CPUSolver::setNumThreads(int num_threads) {
+void CPUSolver::setNumThreads(int num_threads, threadAffinity affinity) {
 
   if (num_threads <= 0)
     log_printf(ERROR, "Unable to set the number of threads for the Solver "
@@ -163,6 +350,364 @@ void CPUSolver::setNumThreads(int num_threads) {
 
   /* Set the number of threads for OpenMP */
   omp_set_num_threads(_num_threads);
+
+  /* Pin the threads, or unpin threads which were previously pinned */
+  if (affinity != AFFINITY_NONE || _thread_affinity != AFFINITY_NONE)
+    pin_openmp_threads(affinity);
+
+  _thread_affinity = affinity;
+}
+
+
+/**
+ * @brief Sets the placement of the pages of the flux and source arrays on
+ *        NUMA nodes.
+ * @details With the default FIRST_TOUCH placement, the arrays for each Track
+ *          are first touched by the thread which sweeps the Track, and the
+ *          arrays for each FSR by the thread which computes its source.
+ *          With INTERLEAVED placement, the pages are spread evenly across
+ *          the NUMA nodes, which balances the memory bandwidth if the
+ *          threads are not pinned. This must be set before the source is
+ *          converged, and may be set from Python as follows:
+ *
+ * @code
+ *          solver.setPagePlacement(openmoc.INTERLEAVED)
+ * @endcode
+ *
+ * @param placement the page placement (FIRST_TOUCH or INTERLEAVED)
+ */
+void CPUSolver::setPagePlacement(pagePlacement placement) {
+  _page_placement = placement;
+}
+
+
+/**
+ * @brief Sets the pages backing the Track boundary flux and leakage arrays.
+ * @details Each Track swept reads and writes its boundary fluxes and those
+ *          of the Tracks it reflects into, which lie far apart in the arrays
+ *          for large geometries and miss the TLB if the arrays are backed
+ *          by normal pages. Reserved 2 MB or 1 GB huge pages fall back to
+ *          transparent huge pages, and then to normal pages, if none are
+ *          available. The segments may be backed by huge pages with
+ *          TrackGenerator::setHugePages(...). This must be set before the
+ *          source is converged, for example from Python as follows:
+ *
+ * @code
+ *          solver.setHugePages(openmoc.HUGE_PAGES_2MB)
+ * @endcode
+ *
+ * @param huge_pages the pages to back the boundary fluxes with
+ */
+void CPUSolver::setHugePages(hugePageType huge_pages) {
+  _huge_pages = huge_pages;
+}
+
+
+/**
+ * @brief Sets the scheme used to accumulate FSR scalar fluxes and Cmfd Mesh
+ *        surface currents from concurrent threads during a transport sweep.
+ * @details The default LOCKS scheme allocates one OpenMP lock per FSR and
+ *          Mesh surface. The STRIPED_LOCKS scheme shares a fixed number of
+ *          locks across all FSRs, and the ATOMICS scheme uses lock-free
+ *          atomic additions and does not allocate any locks. This may be
+ *          called from Python prior to converging the source as follows:
+ *
+ * @code
+ *          solver.setFluxAccumulationType(openmoc.ATOMICS)
+ * @endcode
+ *
+ * @param accumulation_type the flux accumulation scheme
+ */
+void CPUSolver::setFluxAccumulationType(fluxAccumulationType
+                                        accumulation_type) {
+  _accumulation_type = accumulation_type;
+}
+
+
+/**
+ * @brief Sets the scheme used to schedule Tracks on threads during each
+ *        transport sweep.
+ * @details The default HALFSPACE_SWEEP sweeps all Tracks in each azimuthal
+ *          angle halfspace concurrently and uses the flux accumulation
+ *          scheme to resolve conflicting FSR updates. The COLORED_SWEEP
+ *          sweeps each color of Tracks computed by
+ *          TrackGenerator::colorTracks() concurrently, with a barrier
+ *          between colors. Since Tracks with the same color do not share
+ *          any FSRs (or Cmfd Mesh surfaces), fluxes are accumulated with
+ *          plain additions. The PIPELINED_SWEEP sweeps the Tracks in both
+ *          halfspaces as OpenMP tasks without a barrier between them, and
+ *          each Track in the second halfspace is swept as soon as the
+ *          Tracks reflecting into it from the first halfspace have been
+ *          swept. The PARTITIONED_SWEEP sweeps each range of Tracks from
+ *          TrackGenerator::partitionTracks(...) on one thread, such that each
+ *          thread sweeps about the same number of segments in each halfspace
+ *          without the scheduling overhead of the HALFSPACE_SWEEP. This may
+ *          be called from Python prior to converging the source as follows:
+ *
+ * @code
+ *          solver.setSweepType(openmoc.COLORED_SWEEP)
+ * @endcode
+ *
+ * @param sweep_type the sweep type
+ */
+void CPUSolver::setSweepType(sweepType sweep_type) {
+  _sweep_type = sweep_type;
+}
+
+
+/**
+ * @brief Sets whether each source iteration runs in a single parallel region.
+ * @details By default, each step of a source iteration forks and joins its
+ *          own team of threads. In a persistent parallel region, the team
+ *          is forked once per source iteration and the steps share the work
+ *          of their loops among its threads, separated only by the barriers
+ *          needed between them, while the sums over FSRs and Tracks are
+ *          reduced from partial sums of each thread. This reduces the
+ *          overhead of threading for small problems, such as pin cells and
+ *          single assemblies. With CMFD acceleration, the team is joined for
+ *          the CMFD solve before \f$ k_{eff} \f$ is computed. This may be
+ *          called from Python prior to converging the source as follows:
+ *
+ * @code
+ *          solver.setPersistentParallelRegion(True)
+ * @endcode
+ *
+ * @param persistent whether to use a persistent parallel region
+ */
+void CPUSolver::setPersistentParallelRegion(bool persistent) {
+  _persistent_parallel_region = persistent;
+}
+
+
+/**
+ * @brief Sets the number of locks shared by all FSRs (or Mesh surfaces)
+ *        when accumulating fluxes with STRIPED_LOCKS (>0).
+ * @param num_lock_stripes the number of lock stripes
+ */
+void CPUSolver::setNumLockStripes(int num_lock_stripes) {
+
+  if (num_lock_stripes <= 0)
+    log_printf(ERROR, "Unable to set the number of lock stripes for the "
+               "Solver to %d since it is less than or equal to 0",
+               num_lock_stripes);
+
+  _num_lock_stripes = num_lock_stripes;
+}
+
+
+/**
+ * @brief Sets the maximum memory for a cache of the exponentials for each
+ *        Track segment, polar angle and energy group (>=0).
+ * @details Since the cross-sections and segment lengths do not change during
+ *          source convergence, the exponentials may be evaluated once and
+ *          reused by each transport sweep. Tracks are cached in order of
+ *          increasing Track ID until the cache is full, and the exponentials
+ *          for the remaining Tracks are evaluated during each sweep. The
+ *          cache is disabled (default) if the size is zero. This may be
+ *          called from Python as follows:
+ *
+ * @code
+ *          solver.setExponentialCacheSize(2048.)
+ * @endcode
+ *
+ * @param max_memory the maximum exponential cache size (MB)
+ */
+void CPUSolver::setExponentialCacheSize(double max_memory) {
+
+  if (max_memory < 0.)
+    log_printf(ERROR, "Unable to set the exponential cache size to %f MB "
+               "since it is negative", max_memory);
+
+  _exp_cache_max_memory = max_memory;
+}
+
+
+/**
+ * @brief Sets whether to store the cached exponentials in single precision
+ *        to fit twice as many segments within the exponential cache size.
+ * @param single_precision whether to use single precision exponentials
+ */
+void CPUSolver::setExponentialCacheSinglePrecision(bool single_precision) {
+  _exp_cache_single_precision = single_precision;
+}
+
+
+/**
+ * @brief Sets whether to store the Track boundary angular fluxes in single
+ *        precision to halve the memory for the largest array of the Solver.
+ * @details Each thread sweeps a Track with its angular fluxes converted to
+ *          a buffer in the Solver's floating point precision, such that
+ *          only the angular fluxes transferred between Tracks are rounded
+ *          to single precision. The FSR scalar fluxes, sources, leakage and
+ *          the reductions for the eigenvalue keep the Solver's precision.
+ *          This has no effect if the Solver is compiled in single precision
+ *          and is not supported by the VectorizedSolver. This may be set
+ *          from Python before the source is converged:
+ *
+ * @code
+ *          solver.setBoundaryFluxSinglePrecision(True)
+ * @endcode
+ *
+ * @param single_precision whether to use single precision boundary fluxes
+ */
+void CPUSolver::setBoundaryFluxSinglePrecision(bool single_precision) {
+  _boundary_flux_single_precision = single_precision;
+}
+
+
+/**
+ * @brief Prints the number of pages of the flux and source arrays on each
+ *        NUMA node.
+ * @details This may be used to check that the pages of each array are
+ *          placed as requested with setPagePlacement(...) once the source
+ *          has been converged, as follows:
+ *
+ * @code
+ *          solver.computeEigenvalue()
+ *          solver.printPagePlacement()
+ * @endcode
+ */
+void CPUSolver::printPagePlacement() {
+
+  long track_size = (long)_tot_num_tracks * 2 * _polar_times_groups;
+  long fsr_size = (long)_num_FSRs * _num_groups;
+
+  log_printf(NORMAL, "Pages of the solver arrays on %d NUMA nodes:",
+             get_num_numa_nodes());
+
+  if (_float_boundary_flux != NULL)
+    printArrayPagePlacement("boundary flux", _float_boundary_flux,
+                            track_size * sizeof(float));
+  else
+    printArrayPagePlacement("boundary flux", _boundary_flux,
+                            track_size * sizeof(FP_PRECISION));
+
+  printArrayPagePlacement("boundary leakage", _boundary_leakage,
+                          track_size * sizeof(FP_PRECISION));
+  printArrayPagePlacement("scalar flux", _scalar_flux,
+                          fsr_size * sizeof(FP_PRECISION));
+  printArrayPagePlacement("reduced source", _reduced_source,
+                          fsr_size * sizeof(FP_PRECISION));
+  printArrayPagePlacement("FSR volumes", _FSR_volumes,
+                          _num_FSRs * sizeof(FP_PRECISION));
+}
+
+
+/**
+ * @brief Prints the number of pages of an array on each NUMA node.
+ * @param name the name of the array
+ * @param array a pointer to the array
+ * @param size the size of the array (bytes)
+ */
+void CPUSolver::printArrayPagePlacement(const char* name, void* array,
+                                        size_t size) {
+
+  if (array == NULL)
+    return;
+
+  long num_node_pages[MAX_NUMA_NODES];
+
+  if (!count_numa_pages(array, size, num_node_pages)) {
+    log_printf(RESULT, "%-18s NUMA nodes unavailable", name);
+    return;
+  }
+
+  std::stringstream pages;
+  int num_nodes = std::min(get_num_numa_nodes(), MAX_NUMA_NODES);
+
+  for (int n=0; n < num_nodes; n++)
+    pages << " " << num_node_pages[n];
+
+  log_printf(RESULT, "%-18s pages per node:%s", name, pages.str().c_str());
+}
+
+
+/**
+ * @brief Places the pages of an array with a value for each Track on the
+ *        NUMA nodes of the threads which sweep the Tracks, and zeroes it.
+ * @details For FIRST_TOUCH placement, each thread writes the values for the
+ *          Tracks which it sweeps first. This follows the sweep for the
+ *          PARTITIONED_SWEEP, while for the other sweep types each thread
+ *          touches an equal range of Tracks in sweep order. For INTERLEAVED
+ *          placement, the pages are spread across all NUMA nodes.
+ * @param array a pointer to the array
+ * @param track_size the size of the values for each Track (bytes)
+ */
+void CPUSolver::placeTrackArray(void* array, size_t track_size) {
+
+  char* bytes = (char*)array;
+
+  if (_page_placement == INTERLEAVED)
+    interleave_pages(array, _tot_num_tracks * track_size);
+
+  /* The Tracks sorted for spatial locality if they have been sorted */
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
+
+  if (_sweep_type == PARTITIONED_SWEEP &&
+      (!_track_generator->containsTrackPartitioning() ||
+       _track_generator->getNumPartitions() != _num_threads))
+    _track_generator->partitionTracks(_num_threads);
+
+  int num_half_tracks = _tot_num_tracks / 2;
+
+  #pragma omp parallel
+  {
+    int tid = omp_get_thread_num();
+    int num_threads = omp_get_num_threads();
+    int min_track, max_track;
+
+    /* Loop over azimuthal angle halfspaces */
+    for (int i=0; i < 2; i++) {
+
+      /* Find the range of Tracks in sweep order touched by this thread */
+      if (_sweep_type == PARTITIONED_SWEEP &&
+          num_threads == _track_generator->getNumPartitions()) {
+        int* offsets = _track_generator->getPartitionOffsets();
+        min_track = offsets[i * (num_threads + 1) + tid];
+        max_track = offsets[i * (num_threads + 1) + tid + 1];
+      }
+      else {
+        min_track = i * num_half_tracks +
+             (long)num_half_tracks * tid / num_threads;
+        max_track = i * num_half_tracks +
+             (long)num_half_tracks * (tid + 1) / num_threads;
+      }
+
+      for (int t=min_track; t < max_track; t++) {
+        int track_id = (sorted_tracks != NULL) ? sorted_tracks[t] : t;
+        memset(&bytes[track_id * track_size], 0, track_size);
+      }
+    }
+  }
+}
+
+
+/**
+ * @brief Places the pages of an array with a value for each FSR on the
+ *        NUMA nodes of the threads which compute the FSR sources, and
+ *        zeroes it.
+ * @details For FIRST_TOUCH placement, each thread writes the values for an
+ *          equal range of FSRs. The FSRs crossed by the Tracks swept by each
+ *          thread then lie on its NUMA node if the FSRs have been renumbered
+ *          in sweep order with TrackGenerator::renumberFSRs(). For
+ *          INTERLEAVED placement, the pages are spread across all NUMA
+ *          nodes.
+ * @param array a pointer to the array
+ * @param fsr_size the size of the values for each FSR (bytes)
+ */
+void CPUSolver::placeFSRArray(void* array, size_t fsr_size) {
+
+  char* bytes = (char*)array;
+
+  if (_page_placement == INTERLEAVED)
+    interleave_pages(array, _num_FSRs * fsr_size);
+
+  #pragma omp parallel for schedule(static)
+  for (int r=0; r < _num_FSRs; r++)
+    memset(&bytes[r * fsr_size], 0, fsr_size);
 }
 
 
@@ -175,11 +720,9 @@ void CPUSolver::setNumThreads(int num_threads) {
 void CPUSolver::initializeFluxArrays() {
 
   /* Delete old flux arrays if they exist */
-  if (_boundary_flux != NULL)
-    delete [] _boundary_flux;
-
-  if (_boundary_leakage != NULL)
-    delete [] _boundary_leakage;
+  huge_page_free(_boundary_flux);
+  huge_page_free(_float_boundary_flux);
+  huge_page_free(_boundary_leakage);
 
   if (_scalar_flux != NULL)
     delete [] _scalar_flux;
@@ -187,22 +730,56 @@ void CPUSolver::initializeFluxArrays() {
   if (_thread_fsr_flux != NULL)
     delete [] _thread_fsr_flux;
 
-  int size;
+  if (_thread_track_flux != NULL)
+    delete [] _thread_track_flux;
 
-  /* Allocate memory for the Track boundary flux and leakage arrays */
+  _boundary_flux = NULL;
+  _float_boundary_flux = NULL;
+  _boundary_leakage = NULL;
+  _thread_track_flux = NULL;
+
+  long size;
+
+  /* Allocate memory for the Track boundary flux and leakage arrays, backed
+   * by huge pages if requested */
   try{
 
-    size = 2 * _tot_num_tracks * _polar_times_groups;
-    _boundary_flux = new FP_PRECISION[size];
-    _boundary_leakage = new FP_PRECISION[size];
+    size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+    _boundary_leakage = (FP_PRECISION*)
+         huge_page_malloc(size * sizeof(FP_PRECISION), _huge_pages);
+
+    /* Allocate the boundary fluxes in single precision with a buffer for
+     * the angular fluxes of the Track swept by each thread */
+    if (_boundary_flux_single_precision) {
+      _float_boundary_flux = (float*)
+           huge_page_malloc(size * sizeof(float), _huge_pages);
+      _thread_track_flux = new FP_PRECISION[_polar_times_groups*_num_threads];
+    }
+    else
+      _boundary_flux = (FP_PRECISION*)
+           huge_page_malloc(size * sizeof(FP_PRECISION), _huge_pages);
 
     /* Allocate an array for the FSR scalar flux */
     size = _num_FSRs * _num_groups;
     _scalar_flux = new FP_PRECISION[size];
 
+    /* Place the pages of each Track's fluxes on the NUMA node of the thread
+     * which sweeps it, and those of each FSR's flux on the NUMA node of the
+     * thread which computes its source */
+    size = 2 * _polar_times_groups;
+    placeTrackArray(_boundary_leakage, size * sizeof(FP_PRECISION));
+
+    if (_float_boundary_flux != NULL)
+      placeTrackArray(_float_boundary_flux, size * sizeof(float));
+    else
+      placeTrackArray(_boundary_flux, size * sizeof(FP_PRECISION));
+
+    placeFSRArray(_scalar_flux, _num_groups * sizeof(FP_PRECISION));
+
     /* Allocate a thread local local memory buffer for FSR scalar flux */
     size = _num_groups * _num_threads;
     _thread_fsr_flux = new FP_PRECISION[size];
+    memset(_thread_fsr_flux, 0, size * sizeof(FP_PRECISION));
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the Solver's fluxes. "
@@ -237,6 +814,15 @@ void CPUSolver::initializeSourceArrays() {
   if (_source_residuals != NULL)
     delete [] _source_residuals;
 
+  if (_FSR_fission_rates != NULL)
+    delete [] _FSR_fission_rates;
+
+  if (_FSR_absorption_rates != NULL)
+    delete [] _FSR_absorption_rates;
+
+  if (_thread_group_rates != NULL)
+    delete [] _thread_group_rates;
+
   int size;
 
   /* Allocate memory for all source arrays */
@@ -249,10 +835,25 @@ void CPUSolver::initializeSourceArrays() {
 
     size = _num_threads * _num_groups;
     _scatter_sources = new FP_PRECISION[size];
+    _thread_group_rates = new FP_PRECISION[size];
 
     size = _num_FSRs;
     _source_residuals = new FP_PRECISION[size];
-
+    _FSR_fission_rates = new FP_PRECISION[size];
+    _FSR_absorption_rates = new FP_PRECISION[size];
+
+    /* Place the pages of each FSR's sources on the NUMA node of the thread
+     * which computes them */
+    size = _num_groups * sizeof(FP_PRECISION);
+    placeFSRArray(_fission_sources, size);
+    placeFSRArray(_source, size);
+    placeFSRArray(_old_source, size);
+    placeFSRArray(_reduced_source, size);
+
+    size = sizeof(FP_PRECISION);
+    placeFSRArray(_source_residuals, size);
+    placeFSRArray(_FSR_fission_rates, size);
+    placeFSRArray(_FSR_absorption_rates, size);
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the solver's FSR "
@@ -274,6 +875,75 @@ void CPUSolver::initializePolarQuadrature() {
 
   _quad = new Quadrature(_quadrature_type, _num_polar);
   _polar_times_groups = _num_groups * _num_polar;
+
+  /* The sweep kernels depend on the number of groups and polar angles */
+  initializeSweepKernels();
+}
+
+
+/**
+ * @brief Selects the transport sweep kernels specialized for the number of
+ *        energy groups and polar angles.
+ * @details Kernels are specialized at compile time for 1, 2, 7, 8 and 70
+ *          energy groups and 1, 2 and 3 polar angles such that the loops
+ *          over groups and polar angles may be fully unrolled. Generic
+ *          kernels are used for any other number of groups or polar angles.
+ */
+void CPUSolver::initializeSweepKernels() {
+
+  switch (_num_groups) {
+    case 1:
+      selectSweepKernels<1>();
+      break;
+    case 2:
+      selectSweepKernels<2>();
+      break;
+    case 7:
+      selectSweepKernels<7>();
+      break;
+    case 8:
+      selectSweepKernels<8>();
+      break;
+    case 70:
+      selectSweepKernels<70>();
+      break;
+    default:
+      selectSweepKernels<0>();
+  }
+}
+
+
+template <int NUM_GROUPS>
+void CPUSolver::selectSweepKernels() {
+
+  switch (_num_polar) {
+    case 1:
+      _scalar_flux_kernel = &CPUSolver::scalarFluxTallyKernel<NUM_GROUPS,1>;
+      _boundary_flux_kernel =
+             &CPUSolver::transferBoundaryFluxKernel<NUM_GROUPS,1>;
+      break;
+    case 2:
+      _scalar_flux_kernel = &CPUSolver::scalarFluxTallyKernel<NUM_GROUPS,2>;
+      _boundary_flux_kernel =
+             &CPUSolver::transferBoundaryFluxKernel<NUM_GROUPS,2>;
+      break;
+    case 3:
+      _scalar_flux_kernel = &CPUSolver::scalarFluxTallyKernel<NUM_GROUPS,3>;
+      _boundary_flux_kernel =
+             &CPUSolver::transferBoundaryFluxKernel<NUM_GROUPS,3>;
+      break;
+    default:
+      _scalar_flux_kernel = &CPUSolver::scalarFluxTallyKernel<NUM_GROUPS,0>;
+      _boundary_flux_kernel =
+             &CPUSolver::transferBoundaryFluxKernel<NUM_GROUPS,0>;
+  }
+
+  if (NUM_GROUPS == 0 || _num_polar > 3)
+    log_printf(INFO, "Using generic sweep kernels for %d energy groups "
+               "and %d polar angles", _num_groups, _num_polar);
+  else
+    log_printf(INFO, "Using sweep kernels specialized for %d energy groups "
+               "and %d polar angles", _num_groups, _num_polar);
 }
 
 
@@ -287,6 +957,13 @@ void CPUSolver::buildExpInterpTable() {
 
   FP_PRECISION azim_weight;
 
+  /* Delete the table if it was built for a previous simulation */
+  if (_polar_weights != NULL)
+    delete [] _polar_weights;
+
+  if (_exp_table != NULL)
+    delete [] _exp_table;
+
   _polar_weights = new FP_PRECISION[_num_azim*_num_polar];
 
   /* Compute the total azimuthal weight for tracks at each polar angle */
@@ -299,9 +976,13 @@ void CPUSolver::buildExpInterpTable() {
       _polar_weights(i,p) = azim_weight*_quad->getMultiple(p)*FOUR_PI;
   }
 
-  /* Set size of interpolation table */
-  int num_array_values = 10 * sqrt(1./(8.*_source_convergence_thresh*1e-2));
-  _exp_table_spacing = 10. / num_array_values;
+  /* Set size of interpolation table to span the optical length of every
+   * segment, which may exceed the default range if segments are not split */
+  FP_PRECISION max_optical_length = std::max(FP_PRECISION(MAX_OPTICAL_LENGTH),
+                                             getMaxOpticalLength());
+  int num_array_values =
+       max_optical_length * sqrt(1./(8.*_source_convergence_thresh*1e-2));
+  _exp_table_spacing = max_optical_length / num_array_values;
   _exp_table_size = _two_times_num_polar * num_array_values;
   _exp_table_max_index = _exp_table_size - _two_times_num_polar - 1.;
 
@@ -315,7 +996,12 @@ void CPUSolver::buildExpInterpTable() {
   FP_PRECISION intercept;
   FP_PRECISION slope;
 
-  /* Create exponential linear interpolation table */
+  /* Create exponential linear interpolation table, with its pages spread
+   * across the NUMA nodes of the threads which read it */
+  if (_page_placement == INTERLEAVED)
+    interleave_pages(_exp_table, _exp_table_size * sizeof(FP_PRECISION));
+
+  #pragma omp parallel for private(expon, slope, intercept) schedule(static)
   for (int i=0; i < num_array_values; i ++){
     for (int p=0; p < _num_polar; p++){
       expon = exp(- (i * _exp_table_spacing) / _quad->getSinTheta(p));
@@ -329,10 +1015,28 @@ void CPUSolver::buildExpInterpTable() {
   /* Compute the reciprocal of the table entry spacing */
   _inverse_exp_table_spacing = 1.0 / _exp_table_spacing;
 
+  /* Compute the polynomial with the same error as the interpolation table */
+  _exp_poly_degree = exponential_poly_degree(_source_convergence_thresh*1e-2);
+  exponential_poly_coefficients(_exp_poly_coefficients, _exp_poly_degree);
+
+  if (_polynomial_exponential)
+    log_printf(INFO, "Using a degree %d polynomial for exponentials",
+               _exp_poly_degree);
+
   return;
 }
 
 
+/**
+ * @brief Returns the maximum optical length of any segment in any energy
+ *        group for which the exponential interpolation table is built.
+ * @return the maximum optical length
+ */
+FP_PRECISION CPUSolver::getMaxOpticalLength() {
+  return _track_generator->getMaxOpticalLength();
+}
+
+
 /**
  * @brief Initializes the FSR volumes and Materials array.
  * @details This method assigns each FSR a unique, monotonically increasing
@@ -350,9 +1054,12 @@ void CPUSolver::initializeFSRs() {
   if (_FSR_materials != NULL)
     delete [] _FSR_materials;
 
-  _FSR_volumes = (FP_PRECISION*)calloc(_num_FSRs, sizeof(FP_PRECISION));
+  _FSR_volumes = new FP_PRECISION[_num_FSRs];
   _FSR_materials = new Material*[_num_FSRs];
-  _FSR_locks = new omp_lock_t[_num_FSRs];
+
+  /* Zero the volumes with the pages on the NUMA node of each FSR's thread */
+  placeFSRArray(_FSR_volumes, sizeof(FP_PRECISION));
+  placeFSRArray(_FSR_materials, sizeof(Material*));
 
   int num_segments;
   segment* curr_segment;
@@ -382,7 +1089,7 @@ void CPUSolver::initializeFSRs() {
   for (int r=0; r < _num_FSRs; r++) {
 
     /* Get the Cell corresponding to this FSR from the geometry */
-    cell = _geometry->findCellContainingFSR(r);
+    cell = _geometry->findCellContainingFSR(_geometry->getFSRId(r));
 
     /* Get the Cell's Material and assign it to the FSR */
     material = _geometry->getMaterial(cell->getMaterial());
@@ -393,38 +1100,494 @@ void CPUSolver::initializeFSRs() {
                 _FSR_materials[r]->getUid(), _FSR_volumes[r]);
   }
 
-  /* Loop over all FSRs to initialize OpenMP locks */
-  #pragma omp parallel for schedule(guided)
-  for (int r=0; r < _num_FSRs; r++)
-    omp_init_lock(&_FSR_locks[r]);
+  initializeFSRLocks();
+  initializeSourceBlocks();
+  initializeTrackDependencies();
+
+  /* The exponential cache depends on the FSR Materials */
+  initializeExponentialCache();
 
   return;
 }
 
 
 /**
- * @brief Initializes Cmfd object for acceleration prior to source iteration.
- * @details Instantiates a dummy Cmfd object if one was not assigned to
- *          the Solver by the user and initializes FSRs, Materials, fluxes
- *          and the Mesh. This method intializes a global array for the
- *          surface currents.
+ * @brief Refreshes the exponential interpolation table and the
+ *        exponentials cached for each Track segment after the cross-sections
+ *        of some Materials have changed.
+ * @param materials the Materials whose cross-sections have changed
  */
-void CPUSolver::initializeCmfd() {
+void CPUSolver::updateMaterials(std::vector<Material*>& materials) {
 
-  /* Call parent class method */
-  Solver::initializeCmfd();
+  /* Rebuild the exponential table if it no longer spans every segment */
+  FP_PRECISION table_length =
+       (_exp_table_size / _two_times_num_polar) * _exp_table_spacing;
 
-  /* Delete old Cmfd Mesh surface currents array it it exists */
-  if (_surface_currents != NULL)
-    delete [] _surface_currents;
+  if (computeMaxOpticalLength() > table_length)
+    buildExpInterpTable();
 
-  int size;
+  initializeExponentialCache();
+}
 
-  /* Allocate memory for the Cmfd Mesh surface currents array */
-  try{
 
-    /* Allocate an array for the Cmfd Mesh surface currents */
-    if (_cmfd->getMesh()->getCmfdOn()){
+/**
+ * @brief Computes the maximum optical length of any segment in any energy
+ *        group for the current cross-sections of the FSR Materials.
+ * @details Unlike TrackGenerator::getMaxOpticalLength(), this uses the
+ *          Solver's FSR Materials rather than finding the Cell containing
+ *          each FSR, and may only be called once the FSRs are initialized.
+ * @return the maximum optical length
+ */
+FP_PRECISION CPUSolver::computeMaxOpticalLength() {
+
+  FP_PRECISION* max_sigma_t = new FP_PRECISION[_num_FSRs];
+  FP_PRECISION max_optical_length = 0.;
+
+  /* Find the maximum total cross-section for each FSR */
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    FP_PRECISION* sigma_t = _FSR_materials[r]->getSigmaT();
+    max_sigma_t[r] = 0.;
+
+    for (int e=0; e < _num_groups; e++)
+      max_sigma_t[r] = std::max(max_sigma_t[r], sigma_t[e]);
+  }
+
+  /* Find the maximum optical length over all segments */
+  segment* segments = _track_generator->getSegments();
+  int num_segments = _track_generator->getNumSegments();
+
+  for (int s=0; s < num_segments; s++)
+    max_optical_length = std::max(max_optical_length,
+         segments[s]._length * max_sigma_t[segments[s]._region_id]);
+
+  delete [] max_sigma_t;
+
+  return max_optical_length;
+}
+
+
+/**
+ * @brief Counts the Tracks in the first azimuthal angle halfspace which
+ *        reflect into each Track in the second halfspace.
+ * @details Each Track transfers its outgoing angular fluxes to the Tracks
+ *          reflecting out of it, which lie in the other halfspace. In a
+ *          PIPELINED_SWEEP, a Track in the second halfspace is swept only
+ *          once these Tracks have been swept, such that it uses the same
+ *          incoming fluxes as if the halfspaces were swept one after the
+ *          other, and such that it only updates the incoming fluxes of
+ *          Tracks in the first halfspace which have already been swept.
+ */
+void CPUSolver::initializeTrackDependencies() {
+
+  /* Delete old Track dependency arrays if they exist */
+  if (_num_track_dependencies != NULL)
+    delete [] _num_track_dependencies;
+
+  if (_track_dependencies != NULL)
+    delete [] _track_dependencies;
+
+  int num_half_tracks = _tot_num_tracks / 2;
+
+  try {
+    _num_track_dependencies = new int[num_half_tracks];
+    _track_dependencies = new int[num_half_tracks];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the Track "
+               "dependencies. Backtrace:%s", e.what());
+  }
+
+  memset(_num_track_dependencies, 0, num_half_tracks * sizeof(int));
+
+  for (int i=0; i < num_half_tracks; i++) {
+
+    int track_in_id = _tracks[i]->getTrackIn()->getUid() - num_half_tracks;
+    int track_out_id = _tracks[i]->getTrackOut()->getUid() - num_half_tracks;
+
+    if (track_in_id >= 0 && track_in_id < num_half_tracks)
+      _num_track_dependencies[track_in_id]++;
+
+    if (track_out_id >= 0 && track_out_id < num_half_tracks)
+      _num_track_dependencies[track_out_id]++;
+  }
+}
+
+
+/**
+ * @brief Partitions the FSRs into blocks of FSRs with the same Material.
+ * @details The FSRs are sorted by Material UID and each Material's FSRs are
+ *          divided into blocks of at most SOURCE_BLOCK_SIZE FSRs. The
+ *          sources for each block are computed together such that the
+ *          Material's scattering matrix is reused for all of the block's
+ *          FSRs while it resides in cache.
+ */
+void CPUSolver::initializeSourceBlocks() {
+
+  log_printf(INFO, "Initializing blocks of FSRs for the source...");
+
+  /* Delete old source block arrays if they exist */
+  if (_source_block_offsets != NULL)
+    delete [] _source_block_offsets;
+
+  if (_material_FSRs != NULL)
+    delete [] _material_FSRs;
+
+  /* Find the FSRs for each Material in order of increasing FSR ID */
+  std::map<int, std::vector<int> > material_FSRs;
+  std::map<int, std::vector<int> >::iterator iter;
+
+  for (int r=0; r < _num_FSRs; r++)
+    material_FSRs[_FSR_materials[r]->getUid()].push_back(r);
+
+  /* Count the blocks of FSRs for each Material */
+  _num_source_blocks = 0;
+
+  for (iter = material_FSRs.begin(); iter != material_FSRs.end(); ++iter) {
+    int num_material_FSRs = iter->second.size();
+    _num_source_blocks += (num_material_FSRs + SOURCE_BLOCK_SIZE - 1) /
+                          SOURCE_BLOCK_SIZE;
+  }
+
+  try{
+    _source_block_offsets = new int[_num_source_blocks+1];
+    _material_FSRs = new int[_num_FSRs];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the source blocks. "
+               "Backtrace:%s", e.what());
+  }
+
+  /* Sort the FSRs by Material and set the offsets for each block */
+  int block = 0;
+  int offset = 0;
+
+  for (iter = material_FSRs.begin(); iter != material_FSRs.end(); ++iter) {
+
+    int num_material_FSRs = iter->second.size();
+
+    for (int i=0; i < num_material_FSRs; i++) {
+      if (i % SOURCE_BLOCK_SIZE == 0) {
+        _source_block_offsets[block] = offset;
+        block++;
+      }
+
+      _material_FSRs[offset] = iter->second[i];
+      offset++;
+    }
+  }
+
+  _source_block_offsets[_num_source_blocks] = offset;
+
+  log_printf(DEBUG, "Partitioned %d FSRs with %d Materials into %d source "
+             "blocks", _num_FSRs, material_FSRs.size(), _num_source_blocks);
+
+  return;
+}
+
+
+/**
+ * @brief Evaluates and caches the exponentials for each Track segment,
+ *        polar angle and energy group within the exponential cache size.
+ * @details Whole Tracks are cached in order of increasing Track ID, which
+ *          is the order of the segments in the TrackGenerator, such that
+ *          the segments with cached exponentials are the first segments.
+ */
+void CPUSolver::initializeExponentialCache() {
+
+  deleteExponentialCache();
+
+  if (_exp_cache_max_memory <= 0.)
+    return;
+
+  log_printf(INFO, "Caching exponentials for each Track segment...");
+
+  size_t value_size = sizeof(FP_PRECISION);
+  if (_exp_cache_single_precision)
+    value_size = sizeof(float);
+
+  long max_num_segments = long(_exp_cache_max_memory * 1.E6 /
+                               (value_size * _polar_times_groups));
+  int num_cached_tracks = 0;
+
+  /* Find the Tracks which fit within the cache */
+  for (int i=0; i < _tot_num_tracks; i++) {
+
+    long num_segments = _tracks[i]->getNumSegments();
+
+    if (_num_cached_segments + num_segments > max_num_segments)
+      break;
+
+    _num_cached_segments += num_segments;
+    num_cached_tracks++;
+  }
+
+  _first_segment = _track_generator->getSegments();
+  long size = _num_cached_segments * _polar_times_groups;
+
+  try {
+    if (_exp_cache_single_precision) {
+      _float_exp_cache = new float[size];
+      _thread_exp_buffer = new FP_PRECISION[_num_threads*_polar_times_groups];
+    }
+    else
+      _exp_cache = new FP_PRECISION[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the exponential cache. "
+               "Backtrace:%s", e.what());
+  }
+
+  /* Evaluate the exponentials for each segment of each cached Track */
+  #pragma omp parallel for schedule(guided)
+  for (int i=0; i < num_cached_tracks; i++) {
+
+    int num_segments = _tracks[i]->getNumSegments();
+    segment* segments = _tracks[i]->getSegments();
+
+    for (int s=0; s < num_segments; s++) {
+
+      long index = (&segments[s] - _first_segment) * _polar_times_groups;
+      FP_PRECISION length = segments[s]._length;
+      FP_PRECISION* sigma_t =
+             _FSR_materials[segments[s]._region_id]->getSigmaT();
+      FP_PRECISION exponential;
+
+      for (int p=0; p < _num_polar; p++) {
+        for (int e=0; e < _num_groups; e++) {
+          exponential = computeExponential(sigma_t[e], length, p);
+
+          if (_exp_cache_single_precision)
+            _float_exp_cache[index + p*_num_groups + e] = exponential;
+          else
+            _exp_cache[index + p*_num_groups + e] = exponential;
+        }
+      }
+    }
+  }
+
+  log_printf(NORMAL, "Cached exponentials for %d of %d Tracks (%1.2f MB)",
+             num_cached_tracks, _tot_num_tracks,
+             double(size) * value_size / 1.E6);
+}
+
+
+/**
+ * @brief Deletes the per-segment exponential cache if it was allocated.
+ */
+void CPUSolver::deleteExponentialCache() {
+
+  if (_exp_cache != NULL)
+    delete [] _exp_cache;
+
+  if (_float_exp_cache != NULL)
+    delete [] _float_exp_cache;
+
+  if (_thread_exp_buffer != NULL)
+    delete [] _thread_exp_buffer;
+
+  _exp_cache = NULL;
+  _float_exp_cache = NULL;
+  _thread_exp_buffer = NULL;
+  _num_cached_segments = 0;
+}
+
+
+/**
+ * @brief Returns the cached exponentials for a Track segment for each polar
+ *        angle and energy group.
+ * @details Single precision exponentials are first copied to a buffer for
+ *          the calling thread.
+ * @param curr_segment a pointer to the Track segment of interest
+ * @return a pointer to the exponentials or NULL if they were not cached
+ */
+FP_PRECISION* CPUSolver::getCachedExponentials(segment* curr_segment) {
+
+  long index = curr_segment - _first_segment;
+
+  if (index >= _num_cached_segments)
+    return NULL;
+
+  index *= _polar_times_groups;
+
+  if (!_exp_cache_single_precision)
+    return &_exp_cache[index];
+
+  int tid = omp_get_thread_num();
+  FP_PRECISION* exponentials = &_thread_exp_buffer[tid*_polar_times_groups];
+
+  for (int i=0; i < _polar_times_groups; i++)
+    exponentials[i] = _float_exp_cache[index + i];
+
+  return exponentials;
+}
+
+
+/**
+ * @brief Returns the angular fluxes of a Track for one direction.
+ * @details Single precision angular fluxes are first copied to a buffer
+ *          for the calling thread, which holds the angular fluxes until
+ *          they are transferred to the outgoing Track.
+ * @param track_id the ID number for the Track of interest
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @return a pointer to the angular fluxes
+ */
+FP_PRECISION* CPUSolver::getTrackFlux(int track_id, bool direction) {
+
+  if (_float_boundary_flux == NULL)
+    return &_boundary_flux(track_id,!direction,0,0);
+
+  int tid = omp_get_thread_num();
+  FP_PRECISION* track_flux = &_thread_track_flux[tid*_polar_times_groups];
+  float* float_track_flux = &_float_boundary_flux(track_id,!direction,0,0);
+
+  for (int i=0; i < _polar_times_groups; i++)
+    track_flux[i] = float_track_flux[i];
+
+  return track_flux;
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint to a buffer.
+ * @details Single precision boundary angular fluxes are converted to the
+ *          Solver's floating point precision.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values to
+ */
+void CPUSolver::getCheckpointArray(checkpointArray array, long offset,
+                                   long length, FP_PRECISION* values) {
+
+  if (array != CHECKPOINT_BOUNDARY_FLUX || _float_boundary_flux == NULL) {
+    Solver::getCheckpointArray(array, offset, length, values);
+    return;
+  }
+
+  for (long i=0; i < length; i++)
+    values[i] = _float_boundary_flux[offset + i];
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint from a buffer.
+ * @details Boundary angular fluxes are rounded to single precision if the
+ *          Solver stores them in single precision.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values from
+ */
+void CPUSolver::setCheckpointArray(checkpointArray array, long offset,
+                                   long length, FP_PRECISION* values) {
+
+  if (array != CHECKPOINT_BOUNDARY_FLUX || _float_boundary_flux == NULL) {
+    Solver::setCheckpointArray(array, offset, length, values);
+    return;
+  }
+
+  for (long i=0; i < length; i++)
+    _float_boundary_flux[offset + i] = values[i];
+}
+
+
+/**
+ * @brief Allocates and initializes the OpenMP locks for FSR scalar flux
+ *        updates for the flux accumulation scheme in use.
+ * @details One lock is allocated per FSR for LOCKS, a fixed number of
+ *          locks for STRIPED_LOCKS, and no locks for ATOMICS.
+ */
+void CPUSolver::initializeFSRLocks() {
+
+  /* Delete old locks if they exist */
+  if (_FSR_locks != NULL) {
+    for (int i=0; i < _num_FSR_locks; i++)
+      omp_destroy_lock(&_FSR_locks[i]);
+
+    delete [] _FSR_locks;
+    _FSR_locks = NULL;
+  }
+
+  if (_accumulation_type == LOCKS)
+    _num_FSR_locks = _num_FSRs;
+  else if (_accumulation_type == STRIPED_LOCKS)
+    _num_FSR_locks = std::min(_num_lock_stripes, _num_FSRs);
+  else
+    _num_FSR_locks = 0;
+
+  if (_num_FSR_locks == 0)
+    return;
+
+  _FSR_locks = new omp_lock_t[_num_FSR_locks];
+
+  /* Loop over all locks to initialize them */
+  #pragma omp parallel for schedule(guided)
+  for (int i=0; i < _num_FSR_locks; i++)
+    omp_init_lock(&_FSR_locks[i]);
+}
+
+
+/**
+ * @brief Allocates and initializes the OpenMP locks for Cmfd Mesh surface
+ *        current updates for the flux accumulation scheme in use.
+ */
+void CPUSolver::initializeMeshSurfaceLocks() {
+
+  /* Delete old locks if they exist */
+  if (_mesh_surface_locks != NULL) {
+    for (int i=0; i < _num_mesh_surface_locks; i++)
+      omp_destroy_lock(&_mesh_surface_locks[i]);
+
+    delete [] _mesh_surface_locks;
+    _mesh_surface_locks = NULL;
+  }
+
+  int num_surfaces = _num_mesh_cells * 8;
+
+  if (_accumulation_type == LOCKS)
+    _num_mesh_surface_locks = num_surfaces;
+  else if (_accumulation_type == STRIPED_LOCKS)
+    _num_mesh_surface_locks = std::min(_num_lock_stripes, num_surfaces);
+  else
+    _num_mesh_surface_locks = 0;
+
+  if (_num_mesh_surface_locks == 0)
+    return;
+
+  _mesh_surface_locks = new omp_lock_t[_num_mesh_surface_locks];
+
+  /* Loop over all locks to initialize them */
+  #pragma omp parallel for schedule(guided)
+  for (int i=0; i < _num_mesh_surface_locks; i++)
+    omp_init_lock(&_mesh_surface_locks[i]);
+}
+
+
+/**
+ * @brief Initializes Cmfd object for acceleration prior to source iteration.
+ * @details Instantiates a dummy Cmfd object if one was not assigned to
+ *          the Solver by the user and initializes FSRs, Materials, fluxes
+ *          and the Mesh. This method intializes a global array for the
+ *          surface currents.
+ */
+void CPUSolver::initializeCmfd() {
+
+  /* Call parent class method */
+  Solver::initializeCmfd();
+
+  /* Delete old Cmfd Mesh surface currents array it it exists */
+  if (_surface_currents != NULL)
+    delete [] _surface_currents;
+
+  int size;
+
+  /* Allocate memory for the Cmfd Mesh surface currents array */
+  try{
+
+    /* Allocate an array for the Cmfd Mesh surface currents */
+    if (_cmfd->getMesh()->getCmfdOn()){
       size = _num_mesh_cells * _cmfd->getNumCmfdGroups() * 8;
       log_printf(NORMAL, "creating surface currents of size: %i", size);
       _surface_currents = new double[size];
@@ -436,16 +1599,9 @@ void CPUSolver::initializeCmfd() {
                "Mesh surface currents. Backtrace:%s", e.what());
   }
 
-  if (_cmfd->getMesh()->getCmfdOn()){
-
-    /* Initialize an array of OpenMP locks for each Cmfd Mesh surface */
-    _mesh_surface_locks = new omp_lock_t[_cmfd->getMesh()->getNumCells() * 8];
-
-      /* Loop over all mesh cells to initialize OpenMP locks */
-      #pragma omp parallel for schedule(guided)
-      for (int r=0; r < _num_mesh_cells*8; r++)
-          omp_init_lock(&_mesh_surface_locks[r]);
-    }
+  /* Initialize the OpenMP locks for each Cmfd Mesh surface */
+  if (_cmfd->getMesh()->getCmfdOn())
+    initializeMeshSurfaceLocks();
 
   return;
 }
@@ -462,7 +1618,10 @@ void CPUSolver::zeroTrackFluxes() {
     for (int d=0; d < 2; d++) {
       for (int p=0; p < _num_polar; p++) {
         for (int e=0; e < _num_groups; e++) {
-          _boundary_flux(t,d,p,e) = 0.0;
+          if (_float_boundary_flux != NULL)
+            _float_boundary_flux(t,d,p,e) = 0.0;
+          else
+            _boundary_flux(t,d,p,e) = 0.0;
         }
       }
     }
@@ -478,12 +1637,24 @@ void CPUSolver::zeroTrackFluxes() {
  */
 void CPUSolver::flattenFSRFluxes(FP_PRECISION value) {
 
-  #pragma omp parallel for schedule(guided)
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    CPUSolver::flattenFSRFluxes(value);
+    _in_parallel_region = false;
+    return;
+  }
+
+  #pragma omp for schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
     for (int e=0; e < _num_groups; e++)
       _scalar_flux(r,e) = value;
   }
 
+  #pragma omp single
+  _FSR_rates_tallied = false;
+
   return;
 }
 
@@ -494,7 +1665,16 @@ void CPUSolver::flattenFSRFluxes(FP_PRECISION value) {
   */
 void CPUSolver::zeroSurfaceCurrents() {
 
-  #pragma omp parallel for schedule(guided)
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    CPUSolver::zeroSurfaceCurrents();
+    _in_parallel_region = false;
+    return;
+  }
+
+  #pragma omp for schedule(guided)
   for (int r=0; r < _num_mesh_cells; r++) {
     for (int s=0; s < 8; s++) {
       for (int e=0; e < _num_groups; e++)
@@ -524,58 +1704,96 @@ void CPUSolver::flattenFSRSources(FP_PRECISION value) {
 }
 
 
+/**
+ * @brief Tallies the volume-integrated fission (times \f$ \nu \f$) and
+ *        absorption rates in an FSR from its scalar fluxes.
+ * @param fsr_id the ID for the FSR of interest
+ */
+void CPUSolver::tallyFSRRates(int fsr_id) {
+
+  int tid = omp_get_thread_num() * _num_groups;
+  Material* material = _FSR_materials[fsr_id];
+  FP_PRECISION* sigma_a = material->getSigmaA();
+  FP_PRECISION* nu_sigma_f = material->getNuSigmaF();
+  FP_PRECISION volume = _FSR_volumes[fsr_id];
+
+  for (int e=0; e < _num_groups; e++)
+    _thread_group_rates[tid+e] = sigma_a[e] * _scalar_flux(fsr_id,e);
+
+  _FSR_absorption_rates[fsr_id] =
+       pairwise_sum<FP_PRECISION>(&_thread_group_rates[tid], _num_groups);
+  _FSR_absorption_rates[fsr_id] *= volume;
+
+  for (int e=0; e < _num_groups; e++)
+    _thread_group_rates[tid+e] = nu_sigma_f[e] * _scalar_flux(fsr_id,e);
+
+  _FSR_fission_rates[fsr_id] =
+       pairwise_sum<FP_PRECISION>(&_thread_group_rates[tid], _num_groups);
+  _FSR_fission_rates[fsr_id] *= volume;
+}
+
+
 /**
  * @brief Normalizes all FSR scalar fluxes and Track boundary angular
  *        fluxes to the total fission source (times \f$ \nu \f$).
+ * @details The total fission source is found from the FSR fission rates
+ *          tallied with the scalar fluxes on the previous iteration. The
+ *          FSR scalar fluxes are normalized in the same pass over the FSRs
+ *          as the source update by CPUSolver::computeFSRSources().
  */
 void CPUSolver::normalizeFluxes() {
 
-  FP_PRECISION* nu_sigma_f;
-  FP_PRECISION volume;
   FP_PRECISION tot_fission_source;
   FP_PRECISION norm_factor;
 
-  /* Compute total fission source for each FSR, energy group */
-  #pragma omp parallel for private(volume, nu_sigma_f) \
-    reduction(+:tot_fission_source) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    /* Get pointers to important data structures */
-    nu_sigma_f = _FSR_materials[r]->getNuSigmaF();
-    volume = _FSR_volumes[r];
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    CPUSolver::normalizeFluxes();
+    _in_parallel_region = false;
+    return;
+  }
 
-    for (int e=0; e < _num_groups; e++)
-      _fission_sources(r,e) = nu_sigma_f[e] * _scalar_flux(r,e) * volume;
+  /* Tally the FSR fission rates if the fluxes were reset */
+  if (!_FSR_rates_tallied) {
+    #pragma omp for schedule(guided)
+    for (int r=0; r < _num_FSRs; r++)
+      tallyFSRRates(r);
   }
 
   /* Compute the total fission source */
-  tot_fission_source = pairwise_sum<FP_PRECISION>(_fission_sources,
-                                                  _num_FSRs*_num_groups);
+  tot_fission_source = team_pairwise_sum<FP_PRECISION>(_FSR_fission_rates,
+                                                       _num_FSRs, _team_sums);
 
-  /* Normalize scalar fluxes in each FSR */
+  /* Normalize scalar fluxes in each FSR when computing the sources */
   norm_factor = 1.0 / tot_fission_source;
 
-  log_printf(DEBUG, "Tot. Fiss. Src = %f, Normalization factor = %f",
-             tot_fission_source, norm_factor);
-
-  #pragma omp parallel for schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-    for (int e=0; e < _num_groups; e++)
-      _scalar_flux(r,e) *= norm_factor;
-  }
-
   /* Normalize angular boundary fluxes for each Track */
-  #pragma omp parallel for schedule(guided)
+  #pragma omp for schedule(guided)
   for (int i=0; i < _tot_num_tracks; i++) {
     for (int j=0; j < 2; j++) {
       for (int p=0; p < _num_polar; p++) {
         for (int e=0; e < _num_groups; e++) {
-          _boundary_flux(i,j,p,e) *= norm_factor;
+          if (_float_boundary_flux != NULL)
+            _float_boundary_flux(i,j,p,e) *= norm_factor;
+          else
+            _boundary_flux(i,j,p,e) *= norm_factor;
         }
       }
     }
   }
 
+  /* Update the shared state once all threads have checked the rates */
+  #pragma omp single
+  {
+    _flux_norm_factor = norm_factor;
+    _FSR_rates_tallied = false;
+
+    log_printf(DEBUG, "Tot. Fiss. Src = %f, Normalization factor = %f",
+               tot_fission_source, norm_factor);
+  }
+
   return;
 }
 
@@ -590,14 +1808,21 @@ void CPUSolver::normalizeFluxes() {
  *          /f$ res = \sqrt{\frac{\displaystyle\sum \displaystyle\sum
  *                    \left(\frac{Q^i - Q^{i-1}{Q^i}\right)^2}{\# FSRs}}} \f$
  *
+ *          The sources are computed for blocks of FSRs with the same
+ *          Material as a product of the scattering matrix with the block
+ *          of scalar fluxes. The scalar fluxes are normalized by the factor
+ *          from CPUSolver::normalizeFluxes(), and the fission source,
+ *          reduced source and residual are computed in the same pass.
  * @return the residual between this source and the previous source
  */
 FP_PRECISION CPUSolver::computeFSRSources() {
 
-  int tid;
+  int num_FSRs;
+  int* FSRs;
+  int r;
   Material* material;
   FP_PRECISION scatter_source;
-  FP_PRECISION fission_source;
+  FP_PRECISION fission_source[SOURCE_BLOCK_SIZE];
   FP_PRECISION* nu_sigma_f;
   FP_PRECISION* sigma_s;
   FP_PRECISION* sigma_t;
@@ -605,64 +1830,97 @@ FP_PRECISION CPUSolver::computeFSRSources() {
 
   FP_PRECISION source_residual = 0.0;
 
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    {
+      FP_PRECISION thread_residual = CPUSolver::computeFSRSources();
+
+      #pragma omp master
+      source_residual = thread_residual;
+    }
+
+    _in_parallel_region = false;
+    return source_residual;
+  }
+
   FP_PRECISION inverse_k_eff = 1.0 / _k_eff;
 
-  /* For all FSRs, find the source */
-  #pragma omp parallel for private(tid, material, nu_sigma_f, chi, \
-    sigma_s, sigma_t, fission_source, scatter_source) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
+  /* For all blocks of FSRs with the same Material, find the source */
+  #pragma omp for private(num_FSRs, FSRs, r, material, nu_sigma_f, \
+    chi, sigma_s, sigma_t, fission_source, scatter_source) schedule(guided)
+  for (int b=0; b < _num_source_blocks; b++) {
 
-    tid = omp_get_thread_num();
-    material = _FSR_materials[r];
+    FSRs = &_material_FSRs[_source_block_offsets[b]];
+    num_FSRs = _source_block_offsets[b+1] - _source_block_offsets[b];
+    material = _FSR_materials[FSRs[0]];
     nu_sigma_f = material->getNuSigmaF();
     chi = material->getChi();
     sigma_s = material->getSigmaS();
     sigma_t = material->getSigmaT();
 
-    /* Initialize the source residual to zero */
-    _source_residuals[r] = 0.;
+    /* Compute the fission source for each FSR in the block */
+    for (int i=0; i < num_FSRs; i++) {
 
-    /* Compute fission source for each group */
-    if (material->isFissionable()) {
+      r = FSRs[i];
+
+      /* Normalize the scalar fluxes */
       for (int e=0; e < _num_groups; e++)
-        _fission_sources(r,e) = _scalar_flux(r,e) * nu_sigma_f[e];
+        _scalar_flux(r,e) *= _flux_norm_factor;
 
-        fission_source = pairwise_sum<FP_PRECISION>(&_fission_sources(r,0),
-                                                     _num_groups);
-        fission_source *= inverse_k_eff;
-    }
+      /* Initialize the source residual to zero */
+      _source_residuals[r] = 0.;
 
-    else
-      fission_source = 0.0;
+      if (material->isFissionable()) {
+        for (int e=0; e < _num_groups; e++)
+          _fission_sources(r,e) = _scalar_flux(r,e) * nu_sigma_f[e];
 
-    /* Compute total scattering source for group G */
+        fission_source[i] = pairwise_sum<FP_PRECISION>(&_fission_sources(r,0),
+                                                        _num_groups);
+        fission_source[i] *= inverse_k_eff;
+      }
+
+      else
+        fission_source[i] = 0.0;
+    }
+
+    /* Multiply the scattering matrix by the scalar fluxes for the block of
+     * FSRs such that each row of the matrix is reused for all FSRs */
     for (int G=0; G < _num_groups; G++) {
-      scatter_source = 0;
+      for (int i=0; i < num_FSRs; i++) {
 
-      for (int g=0; g < _num_groups; g++)
-        _scatter_sources(tid,g) = sigma_s[G*_num_groups+g] * _scalar_flux(r,g);
+        r = FSRs[i];
 
-        scatter_source=pairwise_sum<FP_PRECISION>(&_scatter_sources(tid,0),
-                                                   _num_groups);
+        /* Compute total scattering source for group G */
+        scatter_source = 0;
+        for (int g=0; g < _num_groups; g++)
+          scatter_source += sigma_s[G*_num_groups+g] * _scalar_flux(r,g);
 
-      /* Set the total source for FSR r in group G */
-      _source(r,G) = (fission_source * chi[G] + scatter_source) *
-                      ONE_OVER_FOUR_PI;
+        /* Set the total source for FSR r in group G */
+        _source(r,G) = (fission_source[i] * chi[G] + scatter_source) *
+                        ONE_OVER_FOUR_PI;
 
-      _reduced_source(r,G) = _source(r,G) / sigma_t[G];
+        _reduced_source(r,G) = _source(r,G) / sigma_t[G];
 
-      /* Compute the norm of residual of the source in the FSR */
-      if (fabs(_source(r,G)) > 1E-10)
-        _source_residuals[r] += pow((_source(r,G) - _old_source(r,G))
-                                / _source(r,G), 2);
+        /* Compute the norm of residual of the source in the FSR */
+        if (fabs(_source(r,G)) > 1E-10)
+          _source_residuals[r] += pow((_source(r,G) - _old_source(r,G))
+                                  / _source(r,G), 2);
 
-      /* Update the old source */
-      _old_source(r,G) = _source(r,G);
+        /* Update the old source */
+        _old_source(r,G) = _source(r,G);
+      }
     }
   }
 
+  /* The scalar fluxes have been normalized */
+  #pragma omp single
+  _flux_norm_factor = 1.0;
+
   /* Sum up the residuals from each FSR */
-  source_residual = pairwise_sum<FP_PRECISION>(_source_residuals, _num_FSRs);
+  source_residual = team_pairwise_sum<FP_PRECISION>(_source_residuals,
+                                                    _num_FSRs, _team_sums);
   source_residual = sqrt(source_residual / (_num_FSRs * _num_groups));
 
   return source_residual;
@@ -679,69 +1937,46 @@ FP_PRECISION CPUSolver::computeFSRSources() {
  */
 void CPUSolver::computeKeff() {
 
-  int tid;
-  Material* material;
-  FP_PRECISION* sigma_a;
-  FP_PRECISION* nu_sigma_f;
-  FP_PRECISION volume;
-
   FP_PRECISION tot_abs = 0.0;
   FP_PRECISION tot_fission = 0.0;
-
-  FP_PRECISION* FSR_rates = new FP_PRECISION[_num_FSRs];
-  FP_PRECISION* group_rates = new FP_PRECISION[_num_threads * _num_groups];
-
-  /* Loop over all FSRs and compute the volume-weighted absorption rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, sigma_a) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    sigma_a = material->getSigmaA();
-
-    for (int e=0; e < _num_groups; e++)
-      group_rates[tid+e] = sigma_a[e] * _scalar_flux(r,e);
-
-    FSR_rates[r]=pairwise_sum<FP_PRECISION>(&group_rates[tid], _num_groups);
-    FSR_rates[r] *= volume;
+  FP_PRECISION leakage = 0.0;
+
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    CPUSolver::computeKeff();
+    _in_parallel_region = false;
+    return;
   }
 
-  /* Reduce absorption rates across FSRs */
-  tot_abs = pairwise_sum<FP_PRECISION>(FSR_rates, _num_FSRs);
-
-  /* Loop over all FSRs and compute the volume-weighted fission rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, nu_sigma_f) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    nu_sigma_f = material->getNuSigmaF();
-
-    for (int e=0; e < _num_groups; e++)
-      group_rates[tid+e] = nu_sigma_f[e] * _scalar_flux(r,e);
-
-    FSR_rates[r]=pairwise_sum<FP_PRECISION>(&group_rates[tid], _num_groups);
-    FSR_rates[r] *= volume;
+  /* Tally the FSR rates again if Cmfd has updated the fluxes */
+  if (!_FSR_rates_tallied || _cmfd->getMesh()->getAcceleration()) {
+    #pragma omp for schedule(guided)
+    for (int r=0; r < _num_FSRs; r++)
+      tallyFSRRates(r);
   }
 
-  /* Reduce fission rates across FSRs */
-  tot_fission = pairwise_sum<FP_PRECISION>(FSR_rates, _num_FSRs);
+  /* Reduce absorption and fission rates across FSRs */
+  tot_abs = team_pairwise_sum<FP_PRECISION>(_FSR_absorption_rates,
+                                            _num_FSRs, _team_sums);
+  tot_fission = team_pairwise_sum<FP_PRECISION>(_FSR_fission_rates,
+                                                _num_FSRs, _team_sums);
 
   /** Reduce leakage array across Tracks, energy groups, polar angles */
   int size = 2 * _tot_num_tracks * _polar_times_groups;
-  _leakage = pairwise_sum<FP_PRECISION>(_boundary_leakage, size) * 0.5;
-
-  _k_eff = tot_fission / (tot_abs + _leakage);
+  leakage = team_pairwise_sum<FP_PRECISION>(_boundary_leakage, size,
+                                            _team_sums);
 
-  log_printf(DEBUG, "abs = %f, fission = %f, leakage = %f, k_eff = %f",
-             tot_abs, tot_fission, _leakage, _k_eff);
+  #pragma omp single
+  {
+    _FSR_rates_tallied = true;
+    _leakage = leakage * 0.5;
+    _k_eff = tot_fission / (tot_abs + _leakage);
 
-  delete [] FSR_rates;
-  delete [] group_rates;
+    log_printf(DEBUG, "abs = %f, fission = %f, leakage = %f, k_eff = %f",
+               tot_abs, tot_fission, _leakage, _k_eff);
+  }
 
   return;
 }
@@ -752,20 +1987,29 @@ void CPUSolver::computeKeff() {
  *        Tracks, Track segments, polar angles and energy groups.
  * @details The method integrates the flux along each Track and updates the
  *          boundary fluxes for the corresponding output Track, while updating
- *          the scalar flux in each flat source region.
+ *          the scalar flux in each flat source region. Tracks are scheduled
+ *          on threads by azimuthal angle halfspace, by Track color or by
+ *          range of Tracks depending on the sweep type. The work of each
+ *          thread is recorded if the sweep is reported.
  */
 void CPUSolver::transportSweep() {
 
-  int tid;
   int min_track, max_track;
-  Track* curr_track;
-  int azim_index;
-  int num_segments;
-  segment* curr_segment;
-  segment* segments;
-  FP_PRECISION* track_flux;
 
-  log_printf(DEBUG, "Transport sweep with %d OpenMP threads", _num_threads);
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    CPUSolver::transportSweep();
+    _in_parallel_region = false;
+    return;
+  }
+
+  /* The Tracks sorted for spatial locality if they have been sorted */
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
 
   /* Initialize flux in each FSr to zero */
   flattenFSRFluxes(0.0);
@@ -773,52 +2017,306 @@ void CPUSolver::transportSweep() {
   if (_cmfd->getMesh()->getCmfdOn())
     zeroSurfaceCurrents();
 
-  /* Loop over azimuthal angle halfspaces */
-  for (int i=0; i < 2; i++) {
+  /* Prepare the Track schedule and sweep report with one thread */
+  #pragma omp single
+  {
+    log_printf(DEBUG, "Transport sweep with %d OpenMP threads", _num_threads);
+
+    if (_sweep_type == COLORED_SWEEP &&
+        !_track_generator->containsTrackColoring())
+      _track_generator->colorTracks();
+
+    if (_sweep_type == PARTITIONED_SWEEP &&
+        (!_track_generator->containsTrackPartitioning() ||
+         _track_generator->getNumPartitions() != _num_threads))
+      _track_generator->partitionTracks(_num_threads);
+
+    if (_sweep_report)
+      startSweepReport(_num_threads);
+  }
+
+  /* Sweep the Tracks with each color concurrently */
+  if (_sweep_type == COLORED_SWEEP) {
+
+    int num_colors = _track_generator->getNumColors();
+    int* color_offsets = _track_generator->getColorOffsets();
+    int* colored_tracks = _track_generator->getColoredTracks();
+
+    /* Loop over colors in both azimuthal angle halfspaces */
+    for (int c=0; c < num_colors; c++) {
+
+      min_track = color_offsets[c];
+      max_track = color_offsets[c+1];
+
+      /* Loop over each Track with this color */
+      #pragma omp for schedule(guided)
+      for (int t=min_track; t < max_track; t++)
+        sweepTrack(colored_tracks[t]);
+    }
+  }
+
+  /* Sweep the Tracks in both azimuthal angle halfspaces as tasks */
+  else if (_sweep_type == PIPELINED_SWEEP) {
+
+    int num_half_tracks = _tot_num_tracks / 2;
+
+    /* The tasks are created by one thread and swept by the team */
+    #pragma omp single
+    {
+      /* Reset the number of Tracks to sweep before each Track in the
+       * second azimuthal angle halfspace */
+      memcpy(_track_dependencies, _num_track_dependencies,
+             num_half_tracks * sizeof(int));
+
+      /* Sweep any Tracks in the second halfspace which do not depend on
+       * Tracks in the first halfspace */
+      for (int i=0; i < num_half_tracks; i++) {
+        if (_track_dependencies[i] == 0) {
+          #pragma omp task firstprivate(i)
+          sweepTrack(num_half_tracks + i);
+        }
+      }
 
-    /* Compute the minimum and maximum Track IDs corresponding to
-     * this azimuthal angular halfspace */
-    min_track = i * (_tot_num_tracks / 2);
-    max_track = (i + 1) * (_tot_num_tracks / 2);
-
-    /* Loop over each thread within this azimuthal angle halfspace */
-    #pragma omp parallel for private(curr_track, azim_index, num_segments, \
-      curr_segment, segments, track_flux, tid) schedule(guided)
-    for (int track_id=min_track; track_id < max_track; track_id++) {
-
-      tid = omp_get_thread_num();
-
-      /* Initialize local pointers to important data structures */
-      curr_track = _tracks[track_id];
-      azim_index = curr_track->getAzimAngleIndex();
-      num_segments = curr_track->getNumSegments();
-      segments = curr_track->getSegments();
-      track_flux = &_boundary_flux(track_id,0,0,0);
-
-      /* Loop over each Track segment in forward direction */
-      for (int s=0; s < num_segments; s++) {
-        curr_segment = &segments[s];
-        scalarFluxTally(curr_segment, azim_index, track_flux,
-                        &_thread_fsr_flux(tid),true);
+      /* Sweep each Track in the first halfspace, which releases the
+       * Tracks in the second halfspace reflecting out of it */
+      for (int t=0; t < num_half_tracks; t++) {
+        int track_id = (sorted_tracks != NULL) ? sorted_tracks[t] : t;
+        #pragma omp task firstprivate(track_id)
+        sweepTrackTask(track_id);
       }
+    }
+  }
+
+  /* Sweep a range of Tracks in each halfspace with each thread */
+  else if (_sweep_type == PARTITIONED_SWEEP) {
+
+    int* partition_offsets = _track_generator->getPartitionOffsets();
 
-      /* Transfer boundary angular flux to outgoing Track */
-      transferBoundaryFlux(track_id, azim_index, true, track_flux);
+    /* Loop over azimuthal angle halfspaces */
+    for (int i=0; i < 2; i++) {
 
-      /* Loop over each Track segment in reverse direction */
-      track_flux += _polar_times_groups;
+      int* offsets = &partition_offsets[i * (_num_threads + 1)];
 
-      for (int s=num_segments-1; s > -1; s--) {
-        curr_segment = &segments[s];
-        scalarFluxTally(curr_segment, azim_index, track_flux,
-                        &_thread_fsr_flux(tid),false);
+      /* Loop over the Tracks in each thread's range */
+      #pragma omp for schedule(static, 1)
+      for (int tid=0; tid < _num_threads; tid++) {
+        for (int t=offsets[tid]; t < offsets[tid+1]; t++)
+          sweepTrack((sorted_tracks != NULL) ? sorted_tracks[t] : t);
       }
+    }
+  }
+
+  /* Sweep all Tracks in each azimuthal angle halfspace concurrently */
+  else {
 
-      /* Transfer boundary angular flux to outgoing Track */
-      transferBoundaryFlux(track_id, azim_index, false, track_flux);
+    /* Loop over azimuthal angle halfspaces */
+    for (int i=0; i < 2; i++) {
+
+      /* Compute the minimum and maximum Track IDs corresponding to
+       * this azimuthal angular halfspace */
+      min_track = i * (_tot_num_tracks / 2);
+      max_track = (i + 1) * (_tot_num_tracks / 2);
+
+      /* Loop over each thread within this azimuthal angle halfspace */
+      #pragma omp for schedule(guided)
+      for (int t=min_track; t < max_track; t++)
+        sweepTrack((sorted_tracks != NULL) ? sorted_tracks[t] : t);
     }
   }
 
+  if (_sweep_report) {
+    #pragma omp single
+    stopSweepReport();
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Performs one source iteration.
+ * @details With a persistent parallel region, the fluxes are normalized, the
+ *          sources are computed, the Tracks are swept and \f$ k_{eff} \f$
+ *          is updated by the same team of threads. Each of these steps
+ *          shares its loops among the team forked by this Solver, or forks
+ *          a team of its own if called anywhere else, including from a
+ *          parallel region of the calling application.
+ * @return the residual between this source and the previous source
+ */
+FP_PRECISION CPUSolver::sourceIteration() {
+
+  if (!_persistent_parallel_region)
+    return Solver::sourceIteration();
+
+  bool acceleration = _cmfd->getMesh()->getAcceleration();
+  FP_PRECISION residual = 0.;
+
+  /* The steps share the work of their loops among the team forked here */
+  _in_parallel_region = true;
+
+  #pragma omp parallel
+  {
+    normalizeFluxes();
+
+    FP_PRECISION thread_residual = computeFSRSources();
+    transportSweep();
+    addSourceToScalarFlux();
+
+    if (!acceleration)
+      computeKeff();
+
+    #pragma omp master
+    residual = thread_residual;
+  }
+
+  _in_parallel_region = false;
+
+  /* Update the flux with cmfd outside of the parallel region */
+  if (acceleration) {
+    _k_eff = _cmfd->computeKeff();
+    computeKeff();
+  }
+
+  return residual;
+}
+
+
+/**
+ * @brief Sweeps a Track in the first azimuthal angle halfspace as an OpenMP
+ *        task and creates tasks for the Tracks reflecting out of it which
+ *        are ready to be swept.
+ * @details A Track in the second halfspace is ready once all of the Tracks
+ *          reflecting into it have transferred their outgoing fluxes.
+ * @param track_id the ID number for the Track of interest
+ */
+void CPUSolver::sweepTrackTask(int track_id) {
+
+  sweepTrack(track_id);
+
+  int num_half_tracks = _tot_num_tracks / 2;
+  int reflecting_ids[2];
+  int num_remaining;
+
+  reflecting_ids[0] = _tracks[track_id]->getTrackIn()->getUid();
+  reflecting_ids[1] = _tracks[track_id]->getTrackOut()->getUid();
+
+  for (int i=0; i < 2; i++) {
+
+    int t = reflecting_ids[i] - num_half_tracks;
+
+    if (t < 0 || t >= num_half_tracks)
+      continue;
+
+    #pragma omp atomic capture
+    num_remaining = --_track_dependencies[t];
+
+    if (num_remaining == 0) {
+      #pragma omp task firstprivate(t)
+      sweepTrack(num_half_tracks + t);
+    }
+  }
+}
+
+
+/**
+ * @brief Integrates the angular flux along a Track in the forward and
+ *        reverse directions.
+ * @details The scalar flux for consecutive segments in the same FSR is
+ *          tallied into the thread's FSR flux buffer and is flushed to the
+ *          global scalar flux only once. The outgoing angular fluxes are
+ *          transferred to the Track's reflective Tracks.
+ * @param track_id the ID number for the Track of interest
+ */
+void CPUSolver::sweepTrack(int track_id) {
+
+  int tid = omp_get_thread_num();
+
+  /* Initialize local pointers to important data structures */
+  Track* curr_track = _tracks[track_id];
+  int azim_index = curr_track->getAzimAngleIndex();
+  int num_segments = curr_track->getNumSegments();
+  segment* segments = curr_track->getSegments();
+  segment* curr_segment;
+  FP_PRECISION* track_flux;
+  FP_PRECISION* fsr_flux = &_thread_fsr_flux(tid);
+
+  /* The segments which cross Cmfd Mesh surfaces */
+  meshCrossing* crossings = curr_track->getMeshCrossings();
+  int num_crossings = 0;
+  int c = 0;
+
+  if (_cmfd->getMesh()->getCmfdOn())
+    num_crossings = curr_track->getNumMeshCrossings();
+
+  if (num_segments == 0)
+    return;
+
+  double start_time = 0.;
+
+  if (_sweep_report)
+    start_time = omp_get_wtime();
+
+  int fsr_id = segments[0]._region_id;
+  track_flux = getTrackFlux(track_id, true);
+
+  /* Loop over each Track segment in forward direction */
+  for (int s=0; s < num_segments; s++) {
+    curr_segment = &segments[s];
+
+    if (curr_segment->_region_id != fsr_id) {
+      accumulateScalarFlux(fsr_id, fsr_flux);
+      fsr_id = curr_segment->_region_id;
+    }
+
+    scalarFluxTally(curr_segment, azim_index, track_flux, fsr_flux);
+
+    /* Tally the current across the Mesh surface at the segment end point */
+    if (c < num_crossings && crossings[c]._segment_id == s) {
+      if (crossings[c]._mesh_surface_fwd != -1)
+        accumulateSurfaceCurrent(crossings[c]._mesh_surface_fwd, azim_index,
+                                 track_flux);
+      c++;
+    }
+  }
+
+  /* Transfer boundary angular flux to outgoing Track */
+  transferBoundaryFlux(track_id, azim_index, true, track_flux);
+
+  /* Loop over each Track segment in reverse direction */
+  track_flux = getTrackFlux(track_id, false);
+  c = num_crossings - 1;
+
+  for (int s=num_segments-1; s > -1; s--) {
+    curr_segment = &segments[s];
+
+    if (curr_segment->_region_id != fsr_id) {
+      accumulateScalarFlux(fsr_id, fsr_flux);
+      fsr_id = curr_segment->_region_id;
+    }
+
+    scalarFluxTally(curr_segment, azim_index, track_flux, fsr_flux);
+
+    /* Tally the current across the Mesh surface at the segment start point */
+    if (c >= 0 && crossings[c]._segment_id == s) {
+      if (crossings[c]._mesh_surface_bwd != -1)
+        accumulateSurfaceCurrent(crossings[c]._mesh_surface_bwd, azim_index,
+                                 track_flux);
+      c--;
+    }
+  }
+
+  /* Flush the last FSR along the Track to the global scalar flux */
+  accumulateScalarFlux(fsr_id, fsr_flux);
+
+  /* Transfer boundary angular flux to outgoing Track */
+  transferBoundaryFlux(track_id, azim_index, false, track_flux);
+
+  /* Record the work of this thread for the sweep report */
+  if (_sweep_report) {
+    _thread_busy_times[tid] += omp_get_wtime() - start_time;
+    _thread_num_segments[tid] += 2 * num_segments;
+  }
+
   return;
 }
 
@@ -826,103 +2324,183 @@ void CPUSolver::transportSweep() {
 /**
  * @brief Computes the contribution to the FSR scalar flux from a Track segment.
  * @details This method integrates the angular flux for a Track segment across
- *          energy groups and polar angles, and tallies it into the FSR
- *          scalar flux, and updates the Track's angular flux.
+ *          energy groups and polar angles, and tallies it into the temporary
+ *          FSR scalar flux buffer, and updates the Track's angular flux. The
+ *          buffer is flushed to the global FSR scalar flux by the
+ *          CPUSolver::accumulateScalarFlux(...) routine. The work is done by
+ *          the kernel specialized for the number of energy groups and polar
+ *          angles.
  * @param curr_segment a pointer to the Track segment of interest
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param track_flux a pointer to the Track's angular flux
  * @param fsr_flux a pointer to the temporary FSR flux buffer
- * @param fwd
  */
 void CPUSolver::scalarFluxTally(segment* curr_segment,
                                 int azim_index,
                                 FP_PRECISION* track_flux,
-                                FP_PRECISION* fsr_flux,
-                                bool fwd){
+                                FP_PRECISION* fsr_flux){
+  (this->*_scalar_flux_kernel)(curr_segment, azim_index, track_flux, fsr_flux);
+}
+
+
+template <int NUM_GROUPS, int NUM_POLAR>
+void CPUSolver::scalarFluxTallyKernel(segment* curr_segment,
+                                      int azim_index,
+                                      FP_PRECISION* track_flux,
+                                      FP_PRECISION* fsr_flux) {
+
+  const int num_groups = (NUM_GROUPS > 0) ? NUM_GROUPS : _num_groups;
+  const int num_polar = (NUM_POLAR > 0) ? NUM_POLAR : _num_polar;
 
-  int tid = omp_get_thread_num();
   int fsr_id = curr_segment->_region_id;
   FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  FP_PRECISION* sigma_t = _FSR_materials[fsr_id]->getSigmaT();
+  FP_PRECISION* reduced_source = &_reduced_source(fsr_id,0);
+  FP_PRECISION* polar_weights = &_polar_weights(azim_index,0);
 
   /* The change in angular flux along this Track segment in the FSR */
   FP_PRECISION delta_psi;
   FP_PRECISION exponential;
 
-  /* Set the FSR scalar flux buffer to zero */
-  memset(fsr_flux, 0.0, _num_groups * sizeof(FP_PRECISION));
+  /* Use the exponentials from the cache if this segment was cached */
+  FP_PRECISION* exponentials = getCachedExponentials(curr_segment);
 
-  /* Loop over energy groups */
-  for (int e=0; e < _num_groups; e++) {
+  if (exponentials != NULL) {
 
     /* Loop over polar angles */
-    for (int p=0; p < _num_polar; p++){
-      exponential = computeExponential(sigma_t[e], length, p);
-      delta_psi = (track_flux(p,e)-_reduced_source(fsr_id,e))*exponential;
-      fsr_flux[e] += delta_psi * _polar_weights[p];
-      track_flux(p,e) -= delta_psi;
+    for (int p=0; p < num_polar; p++){
+
+      /* Loop over energy groups */
+      for (int e=0; e < num_groups; e++) {
+        delta_psi = (track_flux[p*num_groups+e] - reduced_source[e]) *
+                    exponentials[p*num_groups+e];
+        fsr_flux[e] += delta_psi * polar_weights[p];
+        track_flux[p*num_groups+e] -= delta_psi;
+      }
     }
+
+    return;
   }
 
-  if (_cmfd->getMesh()->getCmfdOn()){
-    if (curr_segment->_mesh_surface_fwd != -1 && fwd){
+  /* Loop over energy groups */
+  for (int e=0; e < num_groups; e++) {
 
-      int pe = 0;
+    /* Loop over polar angles */
+    for (int p=0; p < num_polar; p++){
+      exponential = CPUSolver::computeExponential(sigma_t[e], length, p);
+      delta_psi = (track_flux[p*num_groups+e] - reduced_source[e]) *
+                  exponential;
+      fsr_flux[e] += delta_psi * polar_weights[p];
+      track_flux[p*num_groups+e] -= delta_psi;
+    }
+  }
+}
 
-      /* Atomically increment the Cmfd Mesh surface current from the
-       * temporary array using mutual exclusion locks */
-      omp_set_lock(&_mesh_surface_locks[curr_segment->_mesh_surface_fwd]);
 
-      /* Loop over energy groups */
-      for (int e = 0; e < _num_groups; e++) {
+/**
+ * @brief Flushes a thread's temporary FSR scalar flux buffer to the global
+ *        FSR scalar flux and zeroes the buffer.
+ * @details The buffer is added to the global scalar flux with the flux
+ *          accumulation scheme in use (LOCKS, STRIPED_LOCKS or ATOMICS),
+ *          or with plain additions for the COLORED_SWEEP sweep type since
+ *          no other thread may update this FSR concurrently.
+ * @param fsr_id the ID for the FSR of interest
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ */
+void CPUSolver::accumulateScalarFlux(int fsr_id, FP_PRECISION* fsr_flux) {
 
-        /* Loop over polar angles */
-        for (int p = 0; p < _num_polar; p++){
+  /* Increment the FSR scalar flux without any synchronization */
+  if (_sweep_type == COLORED_SWEEP) {
+    for (int e=0; e < _num_groups; e++) {
+      _scalar_flux(fsr_id,e) += fsr_flux[e];
+      fsr_flux[e] = 0.0;
+    }
+  }
 
-          /* Increment current (polar and azimuthal weighted flux, group) */
-          _surface_currents(curr_segment->_mesh_surface_fwd,e) +=
-                                        track_flux(p,e)*_polar_weights[p]/2.0;
-          pe++;
-        }
-      }
+  /* Atomically increment each energy group without any locks */
+  else if (_accumulation_type == ATOMICS) {
+    for (int e=0; e < _num_groups; e++) {
+      #pragma omp atomic
+      _scalar_flux(fsr_id,e) += fsr_flux[e];
+      fsr_flux[e] = 0.0;
+    }
+  }
 
-      /* Release Cmfd Mesh surface mutual exclusion lock */
-      omp_unset_lock(&_mesh_surface_locks[curr_segment->_mesh_surface_fwd]);
+  /* Atomically increment the FSR scalar flux from the temporary array
+   * using the FSR's (or FSR stripe's) mutual exclusion lock */
+  else {
+    omp_lock_t* lock = &_FSR_locks[fsr_id % _num_FSR_locks];
 
+    omp_set_lock(lock);
+    {
+      for (int e=0; e < _num_groups; e++)
+        _scalar_flux(fsr_id,e) += fsr_flux[e];
     }
-    else if (curr_segment->_mesh_surface_bwd != -1 && !fwd){
+    omp_unset_lock(lock);
 
-      int pe = 0;
+    memset(fsr_flux, 0, _num_groups * sizeof(FP_PRECISION));
+  }
 
-      /* Atomically increment the Cmfd Mesh surface current from the
-       * temporary array using mutual exclusion locks */
-      omp_set_lock(&_mesh_surface_locks[curr_segment->_mesh_surface_bwd]);
+  return;
+}
 
-      /* Loop over energy groups */
-      for (int e = 0; e < _num_groups; e++) {
 
-        /* Loop over polar angles */
-        for (int p = 0; p < _num_polar; p++){
+/**
+ * @brief Tallies the current crossing a Cmfd Mesh surface from a Track's
+ *        angular flux into the global Mesh surface currents.
+ * @details The current is added to the global surface currents with the
+ *          flux accumulation scheme in use (LOCKS, STRIPED_LOCKS or ATOMICS),
+ *          or with plain additions for the COLORED_SWEEP sweep type.
+ * @param surface_id the ID for the Cmfd Mesh surface crossed
+ * @param azim_index the azimuthal angle index for the Track
+ * @param track_flux a pointer to the Track's angular flux
+ */
+void CPUSolver::accumulateSurfaceCurrent(int surface_id, int azim_index,
+                                         FP_PRECISION* track_flux) {
+
+  /* Increment the surface current without any synchronization */
+  if (_sweep_type == COLORED_SWEEP) {
+    for (int e = 0; e < _num_groups; e++) {
+      for (int p = 0; p < _num_polar; p++)
+        _surface_currents(surface_id,e) +=
+                       track_flux(p,e) * _polar_weights(azim_index,p) / 2.0;
+    }
+  }
 
-          /* Increment current (polar and azimuthal weighted flux, group) */
-          _surface_currents(curr_segment->_mesh_surface_bwd,e) +=
-                                        track_flux(p,e)*_polar_weights[p]/2.0;
-          pe++;
-        }
+  /* Atomically increment each energy group without any locks */
+  else if (_accumulation_type == ATOMICS) {
+    for (int e = 0; e < _num_groups; e++) {
+      for (int p = 0; p < _num_polar; p++) {
+        #pragma omp atomic
+        _surface_currents(surface_id,e) +=
+                       track_flux(p,e) * _polar_weights(azim_index,p) / 2.0;
       }
-
-      /* Release Cmfd Mesh surface mutual exclusion lock */
-      omp_unset_lock(&_mesh_surface_locks[curr_segment->_mesh_surface_bwd]);
     }
   }
 
-  /* Atomically increment the FSR scalar flux from the temporary array */
-  omp_set_lock(&_FSR_locks[fsr_id]);
-  {
-    for (int e=0; e < _num_groups; e++)
-      _scalar_flux(fsr_id,e) += fsr_flux[e];
+  /* Atomically increment the Cmfd Mesh surface current using the surface's
+   * (or surface stripe's) mutual exclusion lock */
+  else {
+    omp_lock_t* lock =
+          &_mesh_surface_locks[surface_id % _num_mesh_surface_locks];
+
+    omp_set_lock(lock);
+
+    /* Loop over energy groups */
+    for (int e = 0; e < _num_groups; e++) {
+
+      /* Loop over polar angles */
+      for (int p = 0; p < _num_polar; p++) {
+
+        /* Increment current (polar and azimuthal weighted flux, group) */
+        _surface_currents(surface_id,e) +=
+                       track_flux(p,e) * _polar_weights(azim_index,p) / 2.0;
+      }
+    }
+
+    /* Release Cmfd Mesh surface mutual exclusion lock */
+    omp_unset_lock(lock);
   }
-  omp_unset_lock(&_FSR_locks[fsr_id]);
 
   return;
 }
@@ -934,9 +2512,10 @@ void CPUSolver::scalarFluxTally(segment* curr_segment,
  * @details This method computes \f$ 1 - exp(-l\Sigma^T_g/sin(\theta_p)) \f$
  *          for a segment with total group cross-section and for some polar
  *          angle. This method uses either a linear interpolation table
- *          (default) or the exponential intrinsic exp(...) function if
- *          requested by the user through a call to the
- *          Solver::useExponentialIntrinsic()  routine.
+ *          (default), a polynomial or the exponential intrinsic exp(...)
+ *          function if requested by the user through a call to the
+ *          Solver::useExponentialPolynomial() or
+ *          Solver::useExponentialIntrinsic() routines.
  * @param sigma_t the total group cross-section at this energy
  * @param length the length of the Track segment projected in the xy-plane
  * @param p the polar angle index
@@ -957,6 +2536,13 @@ FP_PRECISION CPUSolver::computeExponential(FP_PRECISION sigma_t,
                   _exp_table[index + 2 * p +1]));
   }
 
+  /* Evaluate the exponential using the polynomial */
+  else if (_polynomial_exponential) {
+    FP_PRECISION sintheta = _quad->getSinTheta(p);
+    exponential = exponential_poly(tau / sintheta, _exp_poly_coefficients,
+                                   _exp_poly_degree);
+  }
+
   /* Evalute the exponential using the intrinsic exp(...) function */
   else {
     FP_PRECISION sintheta = _quad->getSinTheta(p);
@@ -981,17 +2567,32 @@ void CPUSolver::transferBoundaryFlux(int track_id,
                                      int azim_index,
                                      bool direction,
                                      FP_PRECISION* track_flux) {
+  (this->*_boundary_flux_kernel)(track_id, azim_index, direction, track_flux);
+}
+
+
+template <int NUM_GROUPS, int NUM_POLAR>
+void CPUSolver::transferBoundaryFluxKernel(int track_id,
+                                           int azim_index,
+                                           bool direction,
+                                           FP_PRECISION* track_flux) {
+
+  const int num_groups = (NUM_GROUPS > 0) ? NUM_GROUPS : _num_groups;
+  const int num_polar = (NUM_POLAR > 0) ? NUM_POLAR : _num_polar;
+  const int polar_times_groups = num_groups * num_polar;
+
   int start;
   int bc;
   FP_PRECISION* track_leakage;
   int track_out_id;
+  FP_PRECISION* polar_weights = &_polar_weights(azim_index,0);
 
   /* Extract boundary conditions for this Track and the pointer to the
    * outgoing reflective Track, and index into the leakage array */
 
   /* For the "forward" direction */
   if (direction) {
-    start = _tracks[track_id]->isReflOut() * _polar_times_groups;
+    start = _tracks[track_id]->isReflOut() * polar_times_groups;
     bc = (int)_tracks[track_id]->getBCOut();
     track_leakage = &_boundary_leakage(track_id,0);
     track_out_id = _tracks[track_id]->getTrackOut()->getUid();
@@ -999,20 +2600,35 @@ void CPUSolver::transferBoundaryFlux(int track_id,
 
   /* For the "reverse" direction */
   else {
-    start = _tracks[track_id]->isReflIn() * _polar_times_groups;
+    start = _tracks[track_id]->isReflIn() * polar_times_groups;
     bc = (int)_tracks[track_id]->getBCIn();
-    track_leakage = &_boundary_leakage(track_id,_polar_times_groups);
+    track_leakage = &_boundary_leakage(track_id,polar_times_groups);
     track_out_id = _tracks[track_id]->getTrackIn()->getUid();
   }
 
+  /* Round the outgoing angular fluxes to single precision if requested */
+  if (_float_boundary_flux != NULL) {
+    float* track_out_flux = &_float_boundary_flux(track_out_id,0,0,start);
+
+    for (int p=0; p < num_polar; p++) {
+      for (int e=0; e < num_groups; e++) {
+        track_out_flux[p*num_groups+e] = track_flux[p*num_groups+e] * bc;
+        track_leakage[p*num_groups+e] = track_flux[p*num_groups+e] *
+                                        polar_weights[p] * (!bc);
+      }
+    }
+
+    return;
+  }
+
   FP_PRECISION* track_out_flux = &_boundary_flux(track_out_id,0,0,start);
 
   /* Loop over polar angles and energy groups */
-  for (int e=0; e < _num_groups; e++) {
-    for (int p=0; p < _num_polar; p++) {
-      track_out_flux(p,e) = track_flux(p,e) * bc;
-      track_leakage(p,e) = track_flux(p,e) *
-                            _polar_weights(azim_index,p) * (!bc);
+  for (int p=0; p < num_polar; p++) {
+    for (int e=0; e < num_groups; e++) {
+      track_out_flux[p*num_groups+e] = track_flux[p*num_groups+e] * bc;
+      track_leakage[p*num_groups+e] = track_flux[p*num_groups+e] *
+                                      polar_weights[p] * (!bc);
     }
   }
 }
@@ -1021,15 +2637,26 @@ void CPUSolver::transferBoundaryFlux(int track_id,
 /**
  * @brief Add the source term contribution in the transport equation to
  *        the FSR scalar flux.
+ * @details The fission and absorption rates in each FSR are tallied in the
+ *          same pass for CPUSolver::computeKeff().
  */
 void CPUSolver::addSourceToScalarFlux() {
 
   FP_PRECISION volume;
   FP_PRECISION* sigma_t;
 
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    CPUSolver::addSourceToScalarFlux();
+    _in_parallel_region = false;
+    return;
+  }
+
   /* Add in source term and normalize flux to volume for each FSR */
   /* Loop over FSRs, energy groups */
-  #pragma omp parallel for private(volume, sigma_t) schedule(guided)
+  #pragma omp for private(volume, sigma_t) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
 
     volume = _FSR_volumes[r];
@@ -1040,8 +2667,13 @@ void CPUSolver::addSourceToScalarFlux() {
         _scalar_flux(r,e) = FOUR_PI * _reduced_source(r,e) +
                             (_scalar_flux(r,e) / (sigma_t[e] * volume));
     }
+
+    tallyFSRRates(r);
   }
 
+  #pragma omp single
+  _FSR_rates_tallied = true;
+
   return;
 }
 
@@ -1074,13 +2706,15 @@ void CPUSolver::computeFSRFissionRates(double* fission_rates, int num_FSRs) {
   for (int r=0; r < _num_FSRs; r++)
     fission_rates[r] = 0.0;
 
-  /* Loop over all FSRs and compute the volume-weighted fission rate */
+  /* Loop over all FSRs and compute the volume-weighted fission rate in
+   * the array indexed by FSR ID */
   #pragma omp parallel for private (sigma_f) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
     sigma_f = _FSR_materials[r]->getSigmaF();
+    int fsr_id = _geometry->getFSRId(r);
 
     for (int e=0; e < _num_groups; e++)
-      fission_rates[r] += sigma_f[e] * _scalar_flux(r,e);
+      fission_rates[fsr_id] += sigma_f[e] * _scalar_flux(r,e);
   }
 
   return;
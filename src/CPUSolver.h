@@ -15,11 +15,15 @@
 #include <omp.h>
 #include <stdlib.h>
 #include "Solver.h"
+#include "numa.h"
 #endif
 
 /** Indexing macro for the thread private FSR scalar fluxes */
 #define _thread_fsr_flux(tid) (_thread_fsr_flux[tid*_num_groups])
 
+/** Indexing macro for the single precision Track boundary angular fluxes */
+#define _float_boundary_flux(i,j,p,e) (_float_boundary_flux[(i)*2*_polar_times_groups + (j)*_polar_times_groups + (p)*_num_groups + (e)])
+
 /** Indexing macro for the angular fluxes for each polar angle and energy
  *  group for either the forward or reverse direction for a given Track */ 
 #define track_flux(p,e) (track_flux[(p)*_num_groups + (e)])
@@ -32,6 +36,56 @@
  *  for either the forward or reverse direction for a given Track */
 #define track_leakage(p,e) (track_leakage[(p)*_num_groups + (e)])
 
+/** Indexing scheme for the exponentials in the neutron transport equation
+ *  (\f$ 1 - exp(-\frac{l\Sigma_t}{sin(\theta_p)}) \f$) for a given
+ *  Track segment for each polar angle and energy group */
+#define exponentials(p,e) (exponentials[(p)*_num_groups + (e)])
+
+/** The maximum number of FSRs with the same Material in a block of FSRs
+ *  whose sources are computed together */
+#define SOURCE_BLOCK_SIZE 32
+
+
+/**
+ * @enum fluxAccumulationType
+ * @brief The scheme used to accumulate FSR scalar fluxes and Cmfd Mesh
+ *        surface currents from concurrent threads during a transport sweep.
+ */
+enum fluxAccumulationType {
+
+  /** One OpenMP mutual exclusion lock per FSR and per Mesh surface */
+  LOCKS,
+
+  /** A fixed number of OpenMP locks shared by FSRs and Mesh surfaces */
+  STRIPED_LOCKS,
+
+  /** Lock-free OpenMP atomic additions for each energy group */
+  ATOMICS
+};
+
+
+/**
+ * @enum sweepType
+ * @brief The scheme used to schedule Tracks on threads during a transport
+ *        sweep.
+ */
+enum sweepType {
+
+  /** All Tracks in each azimuthal angle halfspace are swept concurrently */
+  HALFSPACE_SWEEP,
+
+  /** Tracks with the same color are swept concurrently without any locks */
+  COLORED_SWEEP,
+
+  /** Tracks in both azimuthal angle halfspaces are swept concurrently as
+   *  OpenMP tasks once the Tracks reflecting into them have been swept */
+  PIPELINED_SWEEP,
+
+  /** Each thread sweeps a range of Tracks with about the same number of
+   *  segments in each azimuthal angle halfspace */
+  PARTITIONED_SWEEP
+};
+
 
 /**
  * @class CPUSolver CPUSolver.h "src/CPUSolver.h"
@@ -40,17 +94,67 @@
  * @details This Solver subclass uses OpenMP's multi-threading directives,
  *          including the mutual exclusion locks. Although the algorithm is
  *          more memory efficient than its ThreadPrivateSolver subclass, its
- *          parallel performance scales very poorly. As a result, this class
- *          is not recommended for general use and is primarily intended to
- *          expose the limitations of OpenMP's mutual exclusion formulation.
+ *          parallel performance scales very poorly with one lock per FSR.
+ *          The STRIPED_LOCKS and ATOMICS flux accumulation schemes may be
+ *          selected with CPUSolver::setFluxAccumulationType(...) to reduce
+ *          the memory footprint and contention of the locks. Alternatively,
+ *          the COLORED_SWEEP sweep type may be selected with
+ *          CPUSolver::setSweepType(...) to only sweep Tracks concurrently
+ *          which do not share any FSRs so that no locks are needed, or the
+ *          PIPELINED_SWEEP sweep type to avoid the barrier between the
+ *          azimuthal angle halfspaces, or the PARTITIONED_SWEEP sweep type
+ *          to balance the segments swept by each thread. For small problems,
+ *          each source iteration may run in one persistent parallel region
+ *          with CPUSolver::setPersistentParallelRegion(...). On NUMA
+ *          machines, the threads may be pinned to cores with
+ *          CPUSolver::setNumThreads(...), and the pages of the flux and
+ *          source arrays are first touched by the threads which sweep them
+ *          or interleaved across the NUMA nodes with
+ *          CPUSolver::setPagePlacement(...). The Track boundary fluxes may
+ *          be backed by huge pages with CPUSolver::setHugePages(...). The
+ *          transport sweep kernels are specialized at compile time for 1,
+ *          2, 7, 8 and 70 energy groups with 1, 2 or 3 polar angles.
  */
 class CPUSolver : public Solver {
 
 protected:
 
+  /** A pointer to a scalar flux tally kernel for a Track segment */
+  typedef void (CPUSolver::*scalarFluxKernel)(segment*, int, FP_PRECISION*,
+                                              FP_PRECISION*);
+
+  /** A pointer to a boundary flux transfer kernel for a Track */
+  typedef void (CPUSolver::*boundaryFluxKernel)(int, int, bool,
+                                                FP_PRECISION*);
+
   /** The number of shared memory OpenMP threads */
   int _num_threads;
 
+  /** The pinning of the OpenMP threads to cores */
+  threadAffinity _thread_affinity;
+
+  /** The placement of the pages of the flux and source arrays on NUMA
+   *  nodes */
+  pagePlacement _page_placement;
+
+  /** The pages backing the Track boundary flux and leakage arrays */
+  hugePageType _huge_pages;
+
+  /** The scheme used to accumulate FSR scalar fluxes and surface currents */
+  fluxAccumulationType _accumulation_type;
+
+  /** The scheme used to schedule Tracks on threads during a sweep */
+  sweepType _sweep_type;
+
+  /** The number of locks shared by FSRs or Mesh surfaces for striped locks */
+  int _num_lock_stripes;
+
+  /** The number of OpenMP locks allocated for FSR scalar flux updates */
+  int _num_FSR_locks;
+
+  /** The number of OpenMP locks allocated for surface current updates */
+  int _num_mesh_surface_locks;
+
   /** OpenMP mutual exclusion locks for atomic FSR scalar flux updates */
   omp_lock_t* _FSR_locks;
 
@@ -60,17 +164,125 @@ protected:
   /** A buffer for temporary FSR scalar flux updates for each thread */
   FP_PRECISION* _thread_fsr_flux;
 
+  /** The maximum memory (MB) for the exponential cache (0 to disable it) */
+  double _exp_cache_max_memory;
+
+  /** Whether to store the cached exponentials in single precision */
+  bool _exp_cache_single_precision;
+
+  /** The first of the TrackGenerator's segments for all Tracks */
+  segment* _first_segment;
+
+  /** The number of segments (from the first) with cached exponentials */
+  long _num_cached_segments;
+
+  /** The exponentials for each cached segment, polar angle and group */
+  FP_PRECISION* _exp_cache;
+
+  /** The single precision exponentials for each cached segment, polar angle
+   *  and energy group */
+  float* _float_exp_cache;
+
+  /** A buffer for each thread's exponentials from the single precision
+   *  exponential cache */
+  FP_PRECISION* _thread_exp_buffer;
+
+  /** Whether to store the Track boundary angular fluxes in single
+   *  precision */
+  bool _boundary_flux_single_precision;
+
+  /** The single precision boundary angular fluxes for each Track, direction,
+   *  polar angle and energy group */
+  float* _float_boundary_flux;
+
+  /** A buffer for each thread's angular fluxes for the Track it sweeps
+   *  from the single precision boundary angular fluxes */
+  FP_PRECISION* _thread_track_flux;
+
+  /** The scalar flux tally kernel for the number of energy groups and
+   *  polar angles */
+  scalarFluxKernel _scalar_flux_kernel;
+
+  /** The boundary flux transfer kernel for the number of energy groups and
+   *  polar angles */
+  boundaryFluxKernel _boundary_flux_kernel;
+
+  /** The number of blocks of FSRs with the same Material */
+  int _num_source_blocks;
+
+  /** Offsets into the array of FSR IDs sorted by Material for each block */
+  int* _source_block_offsets;
+
+  /** An array of FSR IDs sorted by Material */
+  int* _material_FSRs;
+
+  /** The volume-integrated fission rate (times \f$ \nu \f$) in each FSR */
+  FP_PRECISION* _FSR_fission_rates;
+
+  /** The volume-integrated absorption rate in each FSR */
+  FP_PRECISION* _FSR_absorption_rates;
+
+  /** A buffer for the reaction rates in each energy group for each thread */
+  FP_PRECISION* _thread_group_rates;
+
+  /** Whether the FSR reaction rates were tallied from the current fluxes */
+  bool _FSR_rates_tallied;
+
+  /** The normalization factor for the FSR scalar fluxes which is applied
+   *  when the sources are next computed */
+  FP_PRECISION _flux_norm_factor;
+
+  /** The number of Tracks in the first azimuthal angle halfspace which
+   *  reflect into each Track in the second halfspace */
+  int* _num_track_dependencies;
+
+  /** The number of Tracks reflecting into each Track in the second
+   *  azimuthal angle halfspace which remain to be swept */
+  int* _track_dependencies;
+
+  /** Whether each source iteration runs in a single parallel region (true)
+   *  or each step forks its own team of threads (false) */
+  bool _persistent_parallel_region;
+
+  /** Whether the steps of a source iteration are called by a team of
+   *  threads forked by this Solver (true), or must fork a team of their own
+   *  (false) */
+  bool _in_parallel_region;
+
+  /** The sums of the subarrays reduced by the team of threads */
+  FP_PRECISION _team_sums[1 << PARALLEL_SUM_MAX_DEPTH];
+
   void initializeFluxArrays();
   void initializeSourceArrays();
   void initializePolarQuadrature();
   void buildExpInterpTable();
+  virtual FP_PRECISION getMaxOpticalLength();
   void initializeFSRs();
   void initializeCmfd();
+  void initializeFSRLocks();
+  void initializeSourceBlocks();
+  void initializeTrackDependencies();
+  void initializeMeshSurfaceLocks();
+  void initializeSweepKernels();
+  void initializeExponentialCache();
+  void placeTrackArray(void* array, size_t track_size);
+  void placeFSRArray(void* array, size_t fsr_size);
+  void printArrayPagePlacement(const char* name, void* array, size_t size);
+  void deleteExponentialCache();
+  void updateMaterials(std::vector<Material*>& materials);
+  FP_PRECISION computeMaxOpticalLength();
+  FP_PRECISION* getCachedExponentials(segment* curr_segment);
+  FP_PRECISION* getTrackFlux(int track_id, bool direction);
+  void getCheckpointArray(checkpointArray array, long offset, long length,
+                          FP_PRECISION* values);
+  void setCheckpointArray(checkpointArray array, long offset, long length,
+                          FP_PRECISION* values);
 
   void zeroTrackFluxes();
   void flattenFSRFluxes(FP_PRECISION value);
   void zeroSurfaceCurrents();
   void flattenFSRSources(FP_PRECISION value);
+  void tallyFSRRates(int fsr_id);
   void normalizeFluxes();
   FP_PRECISION computeFSRSources();
 
@@ -80,11 +292,10 @@ protected:
    * @param azim_index a pointer to the azimuthal angle index for this segment
    * @param track_flux a pointer to the Track's angular flux
    * @param fsr_flux a pointer to the temporary FSR scalar flux buffer
-   * @param fwd
    */
   virtual void scalarFluxTally(segment* curr_segment, int azim_index,
-                               FP_PRECISION* track_flux, FP_PRECISION* fsr_flux,
-                               bool fwd);
+                               FP_PRECISION* track_flux,
+                               FP_PRECISION* fsr_flux);
 
   /**
    * @brief Updates the boundary flux for a Track given boundary conditions.
@@ -96,9 +307,61 @@ protected:
   virtual void transferBoundaryFlux(int track_id, int azim_index,
                                     bool direction,
                                     FP_PRECISION* track_flux);
+
+  /**
+   * @brief Selects the sweep kernels for a number of energy groups.
+   * @tparam NUM_GROUPS the number of energy groups (0 for any number)
+   */
+  template <int NUM_GROUPS>
+  void selectSweepKernels();
+
+  /**
+   * @brief Computes the contribution to the FSR flux from a Track segment
+   *        for a number of energy groups and polar angles fixed at compile
+   *        time.
+   * @tparam NUM_GROUPS the number of energy groups (0 for any number)
+   * @tparam NUM_POLAR the number of polar angles (0 for any number)
+   * @param curr_segment a pointer to the Track segment of interest
+   * @param azim_index the azimuthal angle index for this segment
+   * @param track_flux a pointer to the Track's angular flux
+   * @param fsr_flux a pointer to the temporary FSR scalar flux buffer
+   */
+  template <int NUM_GROUPS, int NUM_POLAR>
+  void scalarFluxTallyKernel(segment* curr_segment, int azim_index,
+                             FP_PRECISION* track_flux,
+                             FP_PRECISION* fsr_flux);
+
+  /**
+   * @brief Updates the boundary flux for a Track for a number of energy
+   *        groups and polar angles fixed at compile time.
+   * @tparam NUM_GROUPS the number of energy groups (0 for any number)
+   * @tparam NUM_POLAR the number of polar angles (0 for any number)
+   * @param track_id the ID number for the Track of interest
+   * @param azim_index the azimuthal angle index for this Track
+   * @param direction the Track direction (forward - true, reverse - false)
+   * @param track_flux a pointer to the Track's outgoing angular flux
+   */
+  template <int NUM_GROUPS, int NUM_POLAR>
+  void transferBoundaryFluxKernel(int track_id, int azim_index,
+                                  bool direction, FP_PRECISION* track_flux);
+
+  void sweepTrack(int track_id);
+  void sweepTrackTask(int track_id);
+  void accumulateScalarFlux(int fsr_id, FP_PRECISION* fsr_flux);
+
+  /**
+   * @brief Tallies the current crossing a Cmfd Mesh surface from a Track's
+   *        angular flux.
+   * @param surface_id the ID for the Cmfd Mesh surface crossed
+   * @param azim_index the azimuthal angle index for the Track
+   * @param track_flux a pointer to the Track's angular flux
+   */
+  virtual void accumulateSurfaceCurrent(int surface_id, int azim_index,
+                                        FP_PRECISION* track_flux);
   void addSourceToScalarFlux();
   void computeKeff();
   void transportSweep();
+  FP_PRECISION sourceIteration();
 
   /**
    * @brief Computes the exponential term in the transport equation for a
@@ -121,14 +384,34 @@ public:
   virtual ~CPUSolver();
 
   int getNumThreads();
+  threadAffinity getThreadAffinity();
+  pagePlacement getPagePlacement();
+  hugePageType getHugePages();
+  fluxAccumulationType getFluxAccumulationType();
+  sweepType getSweepType();
+  bool isUsingPersistentParallelRegion();
+  int getNumLockStripes();
+  double getExponentialCacheSize();
+  long getNumCachedSegments();
   FP_PRECISION getFSRScalarFlux(int fsr_id, int energy_group);
   FP_PRECISION* getFSRScalarFluxes();
   FP_PRECISION getFSRSource(int fsr_id, int energy_group);
   double* getSurfaceCurrents();
 
-  void setNumThreads(int num_threads);
+  void setNumThreads(int num_threads,
+                     threadAffinity affinity=AFFINITY_NONE);
+  void setPagePlacement(pagePlacement placement);
+  void setHugePages(hugePageType huge_pages);
+  void setFluxAccumulationType(fluxAccumulationType accumulation_type);
+  void setSweepType(sweepType sweep_type);
+  virtual void setPersistentParallelRegion(bool persistent);
+  void setNumLockStripes(int num_lock_stripes);
+  void setExponentialCacheSize(double max_memory);
+  void setExponentialCacheSinglePrecision(bool single_precision);
+  void setBoundaryFluxSinglePrecision(bool single_precision);
 
   void computeFSRFissionRates(double* fission_rates, int num_FSRs);
+  void printPagePlacement();
 
 };
 
@@ -1245,7 +1245,7 @@ void Cmfd::initializeFSRs(){
       _FSR_fluxes[fsr_id*_num_groups+e] = 1.0;
 
     /* Get the cell corresponding to this FSR from the geometry */
-    cell = _geometry->findCellContainingFSR(fsr_id);
+    cell = _geometry->findCellContainingFSR(_geometry->getFSRId(fsr_id));
 
     /* Get the cell's material and assign it to the FSR */
     material = _geometry->getMaterial(cell->getMaterial());
@@ -24,6 +24,8 @@ Geometry::Geometry(Mesh* mesh) {
 
   _num_FSRs = 0;
   _num_groups = 0;
+  _FSRs_to_internal_FSRs = NULL;
+  _internal_FSRs_to_FSRs = NULL;
 
   if (mesh == NULL)
     _mesh = new Mesh();
@@ -50,6 +52,8 @@ Geometry::~Geometry() {
     delete [] _FSRs_to_material_UIDs;
     delete [] _FSRs_to_material_IDs;
   }
+
+  clearFSRRenumbering();
 }
 
 
@@ -231,6 +235,43 @@ int* Geometry::getFSRtoMaterialMap() {
 }
 
 
+/**
+ * @brief Returns the internal ID used by the Solvers for an FSR.
+ * @details The internal FSR IDs are the same as the FSR IDs unless the
+ *          FSRs have been renumbered with Geometry::renumberFSRs(...).
+ * @param fsr_id the FSR ID
+ * @return the internal FSR ID
+ */
+int Geometry::getInternalFSRId(int fsr_id) {
+  if (_FSRs_to_internal_FSRs == NULL)
+    return fsr_id;
+
+  return _FSRs_to_internal_FSRs[fsr_id];
+}
+
+
+/**
+ * @brief Returns the FSR ID for an internal FSR ID used by the Solvers.
+ * @param internal_fsr_id the internal FSR ID
+ * @return the FSR ID
+ */
+int Geometry::getFSRId(int internal_fsr_id) {
+  if (_internal_FSRs_to_FSRs == NULL)
+    return internal_fsr_id;
+
+  return _internal_FSRs_to_FSRs[internal_fsr_id];
+}
+
+
+/**
+ * @brief Returns whether the FSRs have been renumbered.
+ * @return true if the FSRs have been renumbered; false otherwise
+ */
+bool Geometry::containsFSRRenumbering() {
+  return _internal_FSRs_to_FSRs != NULL;
+}
+
+
 /**
  * @brief Return the max Track segment length computed during segmentation (cm)
  * @return max Track segment length (cm)
@@ -1246,6 +1287,9 @@ void Geometry::subdivideCells() {
  */
 void Geometry::initializeFlatSourceRegions() {
 
+  /* The FSRs are numbered anew */
+  clearFSRRenumbering();
+
   /* Initialize pointers from CellFills to Universes */
   initializeCellFillPointers();
 
@@ -1276,15 +1320,123 @@ void Geometry::initializeFlatSourceRegions() {
 }
 
 
+/**
+ * @brief Renumbers the FSRs with internal IDs in a given order.
+ * @details The Solvers store the data for each FSR in arrays indexed by
+ *          the FSR's internal ID, which is stored by each Track segment.
+ *          FSRs with nearby internal IDs are stored close to each other in
+ *          memory, so numbering nearby FSRs consecutively keeps the data
+ *          for the FSRs crossed by a Track in fewer cache lines. The FSR
+ *          IDs found from the nested Universe hierarchy are unchanged, and
+ *          are used by all methods which take or return FSR IDs, such as
+ *          Geometry::findFSRId(...) and Solver::getFSRScalarFlux(...). This
+ *          method is called by TrackGenerator::renumberFSRs(), which also
+ *          renumbers the FSRs of its Track segments, but may also be called
+ *          from Python with any order before Tracks are generated:
+ *
+ * @code
+ *          geometry.initializeFlatSourceRegions()
+ *          geometry.renumberFSRs(numpy.arange(geometry.getNumFSRs())[::-1])
+ * @endcode
+ *
+ * @param fsr_ids an array of FSR IDs in the order of their internal IDs
+ * @param num_FSRs the number of FSRs
+ */
+void Geometry::renumberFSRs(int* fsr_ids, int num_FSRs) {
+
+  if (_num_FSRs == 0)
+    log_printf(ERROR, "Unable to renumber FSRs since the Geometry has not "
+               "initialized FSRs.");
+
+  if (num_FSRs != _num_FSRs)
+    log_printf(ERROR, "Unable to renumber FSRs with an array of %d FSR IDs "
+               "since the Geometry contains %d FSRs", num_FSRs, _num_FSRs);
+
+  int* FSRs_to_internal_FSRs = NULL;
+  int* internal_FSRs_to_FSRs = NULL;
+
+  try {
+    FSRs_to_internal_FSRs = new int[_num_FSRs];
+    internal_FSRs_to_FSRs = new int[_num_FSRs];
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the FSR renumbering. "
+               "Backtrace:%s", e.what());
+  }
+
+  for (int r=0; r < _num_FSRs; r++)
+    FSRs_to_internal_FSRs[r] = -1;
+
+  /* Check that each FSR ID is given exactly once */
+  for (int r=0; r < _num_FSRs; r++) {
+    if (fsr_ids[r] < 0 || fsr_ids[r] >= _num_FSRs ||
+        FSRs_to_internal_FSRs[fsr_ids[r]] != -1)
+      log_printf(ERROR, "Unable to renumber FSRs since FSR ID = %d is not "
+                 "a valid FSR ID or is given more than once", fsr_ids[r]);
+
+    FSRs_to_internal_FSRs[fsr_ids[r]] = r;
+    internal_FSRs_to_FSRs[r] = fsr_ids[r];
+  }
+
+  /* Renumber the FSRs in each CMFD Mesh cell */
+  if (_mesh->getCmfdOn()) {
+
+    std::vector< std::vector<int> >* cell_fsrs = _mesh->getCellFSRs();
+    std::vector<int>::iterator iter;
+
+    for (int i=0; i < (int)cell_fsrs->size(); i++) {
+      for (iter = cell_fsrs->at(i).begin();
+           iter != cell_fsrs->at(i).end(); ++iter)
+        *iter = FSRs_to_internal_FSRs[getFSRId(*iter)];
+    }
+
+    _mesh->setFSRBounds();
+  }
+
+  clearFSRRenumbering();
+  _FSRs_to_internal_FSRs = FSRs_to_internal_FSRs;
+  _internal_FSRs_to_FSRs = internal_FSRs_to_FSRs;
+
+  log_printf(INFO, "Renumbered %d FSRs", _num_FSRs);
+}
+
+
+/**
+ * @brief Deletes the FSR renumbering if the FSRs have been renumbered.
+ */
+void Geometry::clearFSRRenumbering() {
+
+  if (_FSRs_to_internal_FSRs != NULL)
+    delete [] _FSRs_to_internal_FSRs;
+
+  if (_internal_FSRs_to_FSRs != NULL)
+    delete [] _internal_FSRs_to_FSRs;
+
+  _FSRs_to_internal_FSRs = NULL;
+  _internal_FSRs_to_FSRs = NULL;
+}
+
+
 /**
  * @brief This method performs ray tracing to create Track segments within each
  *        flat source region in the Geometry.
  * @details This method starts at the beginning of a Track and finds successive
  *          intersection points with FSRs as the Track crosses through the
- *          Geometry and creates segment structs and adds them to the Track.
+ *          Geometry and fills in a segment struct for each one. If no array
+ *          of segments is given, the segments are only counted. This permits
+ *          the TrackGenerator to size a contiguous array for the segments of
+ *          all Tracks before filling it in with a second ray tracing pass.
+ *          Each segment is split into equal pieces such that the optical
+ *          length of each piece in each energy group does not exceed the
+ *          maximum optical length. Segments are not split if the maximum
+ *          optical length is infinite.
  * @param track a pointer to a track to segmentize
+ * @param segments an optional array to store the Track's segments
+ * @param max_optical_length the maximum optical length of a segment
+ * @return the number of segments along the Track
  */
-void Geometry::segmentize(Track* track) {
+int Geometry::segmentize(Track* track, segment* segments,
+                         FP_PRECISION max_optical_length) {
 
   /* Track starting Point coordinates and azimuthal angle */
   double x0 = track->getStart()->getX();
@@ -1298,6 +1450,10 @@ void Geometry::segmentize(Track* track) {
   FP_PRECISION* sigma_t;
   int min_num_segments;
   int num_segments;
+  int tot_num_segments = 0;
+  int mesh_surface_fwd;
+  int mesh_surface_bwd;
+  segment* new_segment;
 
   /* Use a LocalCoords for the start and end of each segment */
   LocalCoords segment_start(x0, y0);
@@ -1314,9 +1470,11 @@ void Geometry::segmentize(Track* track) {
     log_printf(ERROR, "Could not find a Cell containing the start Point "
                "of this Track: %s", track->toString().c_str());
 
+  if (segments != NULL)
+    track->clearMeshCrossings();
+
   /* While the end of the segment's LocalCoords is still within the Geometry,
-   * move it to the next Cell, create a new segment, and add it to the
-   * Geometry */
+   * move it to the next Cell and create a new segment */
   while (curr != NULL) {
 
     segment_end.copyCoords(&segment_start);
@@ -1341,24 +1499,30 @@ void Geometry::segmentize(Track* track) {
     segment_material = _materials.at(static_cast<CellBasic*>(prev)
                        ->getMaterial());
     sigma_t = segment_material->getSigmaT();
-    fsr_id = findFSRId(&segment_start);
 
     /* Compute the number of Track segments to cut this segment into to ensure
      * that it's length is small enough for the exponential table */
     min_num_segments = 1;
     for (int e=0; e < _num_groups; e++) {
-      num_segments = ceil(segment_length * sigma_t[e] / 10.0);
+      num_segments = ceil(segment_length * sigma_t[e] / max_optical_length);
       if (num_segments > min_num_segments)
       min_num_segments = num_segments;
     }
 
+    tot_num_segments += min_num_segments;
+
+    /* Only count the segments if no array was given to store them */
+    if (segments == NULL)
+      continue;
+
+    fsr_id = getInternalFSRId(findFSRId(&segment_start));
+
     /* "Cut up" Track segment into sub-segments such that the length of each
      * does not exceed the size of the exponential table in the Solver */
     for (int i=0; i < min_num_segments; i++) {
 
       /* Create a new Track segment */
-      segment* new_segment = new segment;
-      new_segment->_material = segment_material;
+      new_segment = &segments[tot_num_segments - min_num_segments + i];
       new_segment->_length = segment_length / FP_PRECISION(min_num_segments);
 
       /* Update the max and min segment lengths */
@@ -1376,20 +1540,18 @@ void Geometry::segmentize(Track* track) {
       /* Get pointer to CMFD Mesh surfaces that the Track segment crosses */
       if (_mesh->getCmfdOn()){
 
-        new_segment->_mesh_surface_fwd =
-                _mesh->findMeshSurface(new_segment->_region_id, &segment_end);
-        new_segment->_mesh_surface_bwd =
-                _mesh->findMeshSurface(new_segment->_region_id, &segment_start);
-      }
-
-      /* Add the segment to the Track */
-      track->addSegment(new_segment);
+        mesh_surface_fwd = _mesh->findMeshSurface(fsr_id, &segment_end);
+        mesh_surface_bwd = _mesh->findMeshSurface(fsr_id, &segment_start);
 
+        if (mesh_surface_fwd != -1 || mesh_surface_bwd != -1)
+          track->addMeshCrossing(tot_num_segments - min_num_segments + i,
+                                 mesh_surface_fwd, mesh_surface_bwd);
+      }
     }
   }
 
   log_printf(DEBUG, "Created %d segments for Track: %s",
-             track->getNumSegments(), track->toString().c_str());
+             tot_num_segments, track->toString().c_str());
 
   /* Truncate the linked list for the LocalCoords */
   segment_start.prune();
@@ -1400,7 +1562,7 @@ void Geometry::segmentize(Track* track) {
   log_printf(DEBUG, "Track %d min. segment length: %f",
              track->getUid(), _min_seg_length);
 
-  return;
+  return tot_num_segments;
 }
 
 
@@ -76,6 +76,14 @@ private:
   /** An array of Material UIDs indexed by FSR IDs */
   int* _FSRs_to_material_IDs;
 
+  /** An array of the internal FSR IDs used by the Solvers indexed by FSR
+   *  IDs, or NULL if the FSRs have not been renumbered */
+  int* _FSRs_to_internal_FSRs;
+
+  /** An array of FSR IDs indexed by the internal FSR IDs used by the
+   *  Solvers, or NULL if the FSRs have not been renumbered */
+  int* _internal_FSRs_to_FSRs;
+
   /** The maximum Track segment length in the Geometry */
   double _max_seg_length;
 
@@ -106,6 +114,7 @@ private:
   Cell* findNextCell(LocalCoords* coords, double angle);
   Cell* findCellContainingCoords(LocalCoords* coords);
   Cell* findCell(Universe* univ, int fsr_id);
+  void clearFSRRenumbering();
 
 public:
 
@@ -127,6 +136,9 @@ public:
   int getNumMaterials();
   int* getFSRtoCellMap();
   int* getFSRtoMaterialMap();
+  int getInternalFSRId(int fsr_id);
+  int getFSRId(int internal_fsr_id);
+  bool containsFSRRenumbering();
   double getMaxSegmentLength();
   double getMinSegmentLength();
   std::map<int, Material*> getMaterials();
@@ -154,7 +166,9 @@ public:
   int findFSRId(LocalCoords* coords);
   void subdivideCells();
   void initializeFlatSourceRegions();
-  void segmentize(Track* track);
+  void renumberFSRs(int* fsr_ids, int num_FSRs);
+  int segmentize(Track* track, segment* segments=NULL,
+                 FP_PRECISION max_optical_length=MAX_OPTICAL_LENGTH);
   void computeFissionability(Universe* univ=NULL);
 
   std::string toString();
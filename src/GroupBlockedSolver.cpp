@@ -0,0 +1,711 @@
+#include "GroupBlockedSolver.h"
+
+
+/**
+ * @brief Constructor initializes the array pointers for the blocks of
+ *        energy groups.
+ * @details The constructor sets a default block size chosen from the cache
+ *          size of the machine.
+ * @param geometry an optional pointer to the Geometry
+ * @param track_generator an optional pointer to the TrackGenerator
+ * @param cmfd an optional pointer to a Cmfd object object
+ */
+GroupBlockedSolver::GroupBlockedSolver(Geometry* geometry,
+                                       TrackGenerator* track_generator,
+                                       Cmfd* cmfd)
+  : CPUSolver(geometry, track_generator, cmfd) {
+
+  _requested_group_block_size = 0;
+  _group_block_cache_size = 0;
+  _num_group_blocks = 0;
+  _group_block_offsets = NULL;
+  _blocked_scalar_flux = NULL;
+  _blocked_reduced_source = NULL;
+}
+
+
+/**
+ * @brief Destructor deletes the arrays for the blocks of energy groups and
+ *        calls the CPUSolver parent class destructor.
+ */
+GroupBlockedSolver::~GroupBlockedSolver() {
+
+  if (_group_block_offsets != NULL)
+    delete [] _group_block_offsets;
+
+  if (_blocked_scalar_flux != NULL)
+    delete [] _blocked_scalar_flux;
+
+  if (_blocked_reduced_source != NULL)
+    delete [] _blocked_reduced_source;
+}
+
+
+/**
+ * @brief Returns the number of energy groups in each block.
+ * @details Once the source has been converged, this is the number of groups
+ *          in the largest block, otherwise it is the block size requested
+ *          (0 if it is chosen from the cache size).
+ * @return the number of energy groups in each block
+ */
+int GroupBlockedSolver::getGroupBlockSize() {
+
+  if (_group_block_offsets == NULL)
+    return _requested_group_block_size;
+
+  return _group_block_offsets[1] - _group_block_offsets[0];
+}
+
+
+/**
+ * @brief Returns the number of blocks of energy groups.
+ * @return the number of blocks of energy groups (0 until the source has
+ *         been converged)
+ */
+int GroupBlockedSolver::getNumGroupBlocks() {
+  return _num_group_blocks;
+}
+
+
+/**
+ * @brief Returns the cache size (bytes) used to choose the block size.
+ * @return the cache size for each thread (0 if it is queried from the
+ *         operating system)
+ */
+long GroupBlockedSolver::getGroupBlockCacheSize() {
+  return _group_block_cache_size;
+}
+
+
+/**
+ * @brief Sets the number of energy groups swept in each block.
+ * @details By default, the block size is chosen such that the FSR scalar
+ *          fluxes and sources for a block fit in the cache of each thread.
+ *          The groups are split into blocks of about the same size which
+ *          do not exceed the requested size. A block size may be set from
+ *          Python as follows:
+ *
+ * @code
+ *          solver = openmoc.GroupBlockedSolver(geometry, track_generator)
+ *          solver.setGroupBlockSize(10)
+ * @endcode
+ *
+ * @param group_block_size the number of energy groups in each block (0 to
+ *        choose it from the cache size)
+ */
+void GroupBlockedSolver::setGroupBlockSize(int group_block_size) {
+
+  if (group_block_size < 0)
+    log_printf(ERROR, "Unable to set the group block size to %d since it "
+               "is negative", group_block_size);
+
+  _requested_group_block_size = group_block_size;
+}
+
+
+/**
+ * @brief Sets the size of the cache for each thread used to choose the
+ *        number of energy groups in each block.
+ * @details By default, the size of the L2 cache is queried from the
+ *          operating system, or GROUP_BLOCK_CACHE_SIZE bytes are assumed
+ *          if it is unavailable.
+ * @param cache_size the cache size (bytes) for each thread (0 to query it)
+ */
+void GroupBlockedSolver::setGroupBlockCacheSize(long cache_size) {
+
+  if (cache_size < 0)
+    log_printf(ERROR, "Unable to set the group block cache size to %ld "
+               "bytes since it is negative", cache_size);
+
+  _group_block_cache_size = cache_size;
+}
+
+
+/**
+ * @brief Splits the energy groups into blocks.
+ * @details Unless a block size was requested, each block holds as many
+ *          groups as fit the FSR scalar fluxes and sources, which are
+ *          reused by all Tracks crossing an FSR, in the cache of a thread.
+ *          The groups are then spread evenly across the blocks.
+ */
+void GroupBlockedSolver::initializeGroupBlocks() {
+
+  long cache_size = _group_block_cache_size;
+
+#ifdef _SC_LEVEL2_CACHE_SIZE
+  if (cache_size == 0)
+    cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+
+  if (cache_size <= 0)
+    cache_size = GROUP_BLOCK_CACHE_SIZE;
+
+  long block_size = _requested_group_block_size;
+
+  if (block_size == 0) {
+    long group_size = 2 * (long)_num_FSRs * sizeof(FP_PRECISION);
+    block_size = std::max(1L, cache_size / group_size);
+  }
+
+  block_size = std::min(block_size, (long)_num_groups);
+  _num_group_blocks = (_num_groups + block_size - 1) / block_size;
+  block_size = (_num_groups + _num_group_blocks - 1) / _num_group_blocks;
+
+  if (_group_block_offsets != NULL)
+    delete [] _group_block_offsets;
+
+  _group_block_offsets = new int[_num_group_blocks+1];
+
+  for (int b=0; b <= _num_group_blocks; b++)
+    _group_block_offsets[b] = std::min(b * (int)block_size, _num_groups);
+
+  log_printf(INFO, "Sweeping %d blocks of up to %d energy groups",
+             _num_group_blocks, (int)block_size);
+}
+
+
+/**
+ * @brief Allocates memory for Track boundary angular flux and leakage and
+ *        FSR scalar flux arrays, and splits the energy groups into blocks.
+ * @details Deletes memory for old flux arrays if they were allocated for a
+ *          previous simulation.
+ */
+void GroupBlockedSolver::initializeFluxArrays() {
+
+  if (_boundary_flux_single_precision)
+    log_printf(ERROR, "Unable to store the boundary fluxes in single "
+               "precision for the GroupBlockedSolver");
+
+  if (_sweep_type == PIPELINED_SWEEP)
+    log_printf(ERROR, "The GroupBlockedSolver is unable to converge the "
+               "source with the PIPELINED_SWEEP sweep type");
+
+  CPUSolver::initializeFluxArrays();
+  initializeGroupBlocks();
+
+  /* Delete old flux arrays if they exist */
+  if (_blocked_scalar_flux != NULL)
+    delete [] _blocked_scalar_flux;
+
+  /* Allocate an array for the FSR scalar flux of each block */
+  try{
+    _blocked_scalar_flux = new FP_PRECISION[_num_FSRs * _num_groups];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the Solver's fluxes. "
+               "Backtrace:%s", e.what());
+  }
+}
+
+
+/**
+ * @brief Allocates memory for FSR source arrays.
+ * @details Deletes memory for old source arrays if they were allocated for a
+ *          previous simulation.
+ */
+void GroupBlockedSolver::initializeSourceArrays() {
+
+  CPUSolver::initializeSourceArrays();
+
+  /* Delete old sources arrays if they exist */
+  if (_blocked_reduced_source != NULL)
+    delete [] _blocked_reduced_source;
+
+  /* Allocate an array for the FSR reduced source of each block */
+  try{
+    _blocked_reduced_source = new FP_PRECISION[_num_FSRs * _num_groups];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the solver's FSR "
+               "sources array. Backtrace:%s", e.what());
+  }
+}
+
+
+/**
+ * @brief Initializes the Cmfd object, which must not accelerate the
+ *        GroupBlockedSolver.
+ */
+void GroupBlockedSolver::initializeCmfd() {
+
+  CPUSolver::initializeCmfd();
+
+  if (_cmfd->getMesh()->getCmfdOn())
+    log_printf(ERROR, "The GroupBlockedSolver is unable to converge the "
+               "source with CMFD");
+}
+
+
+/**
+ * @brief Returns the index in the group-block-major boundary flux array of
+ *        a boundary flux indexed by Track, direction, polar angle and
+ *        energy group.
+ * @param index the index of the boundary flux in the CPUSolver's layout
+ * @return the index of the boundary flux in the blocked layout
+ */
+long GroupBlockedSolver::getBlockedBoundaryFluxIndex(long index) {
+
+  int e = index % _num_groups;
+  long i = index / _num_groups;
+  int p = i % _num_polar;
+  long track_dir = i / _num_polar;
+
+  int b = 0;
+  while (_group_block_offsets[b+1] <= e)
+    b++;
+
+  int g0 = _group_block_offsets[b];
+  int num_block_groups = _group_block_offsets[b+1] - g0;
+
+  return _num_polar * (2 * _tot_num_tracks * (long)g0 +
+                       track_dir * num_block_groups) +
+         p * num_block_groups + e - g0;
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint to a buffer.
+ * @details The boundary angular fluxes are stored in a checkpoint with the
+ *          layout of the CPUSolver, such that a checkpoint may be restarted
+ *          with any block size.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values to
+ */
+void GroupBlockedSolver::getCheckpointArray(checkpointArray array,
+                                            long offset, long length,
+                                            FP_PRECISION* values) {
+
+  if (array != CHECKPOINT_BOUNDARY_FLUX) {
+    CPUSolver::getCheckpointArray(array, offset, length, values);
+    return;
+  }
+
+  for (long i=0; i < length; i++)
+    values[i] = _boundary_flux[getBlockedBoundaryFluxIndex(offset + i)];
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint from a buffer.
+ * @details The boundary angular fluxes are reordered from the layout of the
+ *          CPUSolver to the group-block-major layout.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values from
+ */
+void GroupBlockedSolver::setCheckpointArray(checkpointArray array,
+                                            long offset, long length,
+                                            FP_PRECISION* values) {
+
+  if (array != CHECKPOINT_BOUNDARY_FLUX) {
+    CPUSolver::setCheckpointArray(array, offset, length, values);
+    return;
+  }
+
+  for (long i=0; i < length; i++)
+    _boundary_flux[getBlockedBoundaryFluxIndex(offset + i)] = values[i];
+}
+
+
+/**
+ * @brief This method performs one transport sweep of all azimuthal angles,
+ *        Tracks, Track segments, polar angles and energy groups for each
+ *        block of energy groups in turn.
+ * @details The FSR sources are gathered in the group-block-major layout
+ *          before the sweep, and the FSR scalar fluxes tallied for each
+ *          block are scattered to the scalar flux array after the sweep.
+ *          The Tracks of each block are scheduled on threads with the
+ *          sweep type in use. This may be called by all threads of a
+ *          team forked by this Solver, or from anywhere else to fork a team
+ *          of its own.
+ */
+void GroupBlockedSolver::transportSweep() {
+
+  int min_track, max_track;
+
+  /* Fork a team unless called by a team forked by this Solver */
+  if (!_in_parallel_region) {
+    _in_parallel_region = true;
+    #pragma omp parallel
+    GroupBlockedSolver::transportSweep();
+    _in_parallel_region = false;
+    return;
+  }
+
+  /* The Tracks sorted for spatial locality if they have been sorted */
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
+
+  /* Prepare the Track schedule and sweep report with one thread */
+  #pragma omp single
+  {
+    log_printf(DEBUG, "Transport sweep of %d group blocks with %d OpenMP "
+               "threads", _num_group_blocks, _num_threads);
+
+    if (_sweep_type == COLORED_SWEEP &&
+        !_track_generator->containsTrackColoring())
+      _track_generator->colorTracks();
+
+    if (_sweep_type == PARTITIONED_SWEEP &&
+        (!_track_generator->containsTrackPartitioning() ||
+         _track_generator->getNumPartitions() != _num_threads))
+      _track_generator->partitionTracks(_num_threads);
+
+    if (_sweep_report)
+      startSweepReport(_num_threads);
+  }
+
+  /* Gather the reduced sources and zero the scalar fluxes of each block */
+  #pragma omp for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int b=0; b < _num_group_blocks; b++) {
+      int g0 = _group_block_offsets[b];
+      int num_block_groups = _group_block_offsets[b+1] - g0;
+
+      for (int e=0; e < num_block_groups; e++) {
+        _blocked_reduced_source(g0,num_block_groups,r,e) =
+             _reduced_source(r,g0+e);
+        _blocked_scalar_flux(g0,num_block_groups,r,e) = 0.0;
+      }
+    }
+  }
+
+  /* Sweep all Tracks for each block of energy groups */
+  for (int b=0; b < _num_group_blocks; b++) {
+
+    int g0 = _group_block_offsets[b];
+    int num_block_groups = _group_block_offsets[b+1] - g0;
+
+    /* Sweep the Tracks with each color concurrently */
+    if (_sweep_type == COLORED_SWEEP) {
+
+      int num_colors = _track_generator->getNumColors();
+      int* color_offsets = _track_generator->getColorOffsets();
+      int* colored_tracks = _track_generator->getColoredTracks();
+
+      for (int c=0; c < num_colors; c++) {
+
+        min_track = color_offsets[c];
+        max_track = color_offsets[c+1];
+
+        #pragma omp for schedule(guided)
+        for (int t=min_track; t < max_track; t++)
+          sweepTrackBlock(colored_tracks[t], g0, num_block_groups);
+      }
+    }
+
+    /* Sweep a range of Tracks in each halfspace with each thread */
+    else if (_sweep_type == PARTITIONED_SWEEP) {
+
+      int* partition_offsets = _track_generator->getPartitionOffsets();
+
+      for (int i=0; i < 2; i++) {
+
+        int* offsets = &partition_offsets[i * (_num_threads + 1)];
+
+        #pragma omp for schedule(static, 1)
+        for (int tid=0; tid < _num_threads; tid++) {
+          for (int t=offsets[tid]; t < offsets[tid+1]; t++)
+            sweepTrackBlock((sorted_tracks != NULL) ? sorted_tracks[t] : t,
+                            g0, num_block_groups);
+        }
+      }
+    }
+
+    /* Sweep all Tracks in each azimuthal angle halfspace concurrently */
+    else {
+
+      for (int i=0; i < 2; i++) {
+
+        min_track = i * (_tot_num_tracks / 2);
+        max_track = (i + 1) * (_tot_num_tracks / 2);
+
+        #pragma omp for schedule(guided)
+        for (int t=min_track; t < max_track; t++)
+          sweepTrackBlock((sorted_tracks != NULL) ? sorted_tracks[t] : t,
+                          g0, num_block_groups);
+      }
+    }
+  }
+
+  /* Scatter the scalar fluxes of each block to the FSR scalar fluxes */
+  #pragma omp for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int b=0; b < _num_group_blocks; b++) {
+      int g0 = _group_block_offsets[b];
+      int num_block_groups = _group_block_offsets[b+1] - g0;
+
+      for (int e=0; e < num_block_groups; e++)
+        _scalar_flux(r,g0+e) = _blocked_scalar_flux(g0,num_block_groups,r,e);
+    }
+  }
+
+  #pragma omp single
+  {
+    _FSR_rates_tallied = false;
+
+    if (_sweep_report)
+      stopSweepReport();
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Integrates the angular flux along a Track in the forward and
+ *        reverse directions for a block of energy groups.
+ * @details The scalar flux for consecutive segments in the same FSR is
+ *          tallied into the thread's FSR flux buffer and is flushed to the
+ *          scalar flux of the block only once, as for the CPUSolver.
+ * @param track_id the ID number for the Track of interest
+ * @param g0 the first energy group of the block
+ * @param num_block_groups the number of energy groups in the block
+ */
+void GroupBlockedSolver::sweepTrackBlock(int track_id, int g0,
+                                         int num_block_groups) {
+
+  int tid = omp_get_thread_num();
+
+  /* Initialize local pointers to important data structures */
+  Track* curr_track = _tracks[track_id];
+  int azim_index = curr_track->getAzimAngleIndex();
+  int num_segments = curr_track->getNumSegments();
+  segment* segments = curr_track->getSegments();
+  segment* curr_segment;
+  FP_PRECISION* track_flux;
+  FP_PRECISION* fsr_flux = &_thread_fsr_flux(tid);
+
+  if (num_segments == 0)
+    return;
+
+  double start_time = 0.;
+
+  if (_sweep_report)
+    start_time = omp_get_wtime();
+
+  int fsr_id = segments[0]._region_id;
+  track_flux = &_blocked_boundary_flux(g0,num_block_groups,track_id,0,0);
+
+  /* Loop over each Track segment in forward direction */
+  for (int s=0; s < num_segments; s++) {
+    curr_segment = &segments[s];
+
+    if (curr_segment->_region_id != fsr_id) {
+      accumulateScalarFluxBlock(fsr_id, fsr_flux, g0, num_block_groups);
+      fsr_id = curr_segment->_region_id;
+    }
+
+    scalarFluxTallyBlock(curr_segment, azim_index, track_flux, fsr_flux,
+                         g0, num_block_groups);
+  }
+
+  /* Transfer boundary angular flux to outgoing Track */
+  transferBoundaryFluxBlock(track_id, azim_index, true, track_flux,
+                            g0, num_block_groups);
+
+  /* Loop over each Track segment in reverse direction */
+  track_flux = &_blocked_boundary_flux(g0,num_block_groups,track_id,1,0);
+
+  for (int s=num_segments-1; s > -1; s--) {
+    curr_segment = &segments[s];
+
+    if (curr_segment->_region_id != fsr_id) {
+      accumulateScalarFluxBlock(fsr_id, fsr_flux, g0, num_block_groups);
+      fsr_id = curr_segment->_region_id;
+    }
+
+    scalarFluxTallyBlock(curr_segment, azim_index, track_flux, fsr_flux,
+                         g0, num_block_groups);
+  }
+
+  /* Flush the last FSR along the Track to the scalar flux of the block */
+  accumulateScalarFluxBlock(fsr_id, fsr_flux, g0, num_block_groups);
+
+  /* Transfer boundary angular flux to outgoing Track */
+  transferBoundaryFluxBlock(track_id, azim_index, false, track_flux,
+                            g0, num_block_groups);
+
+  /* Record the work of this thread for the sweep report */
+  if (_sweep_report) {
+    _thread_busy_times[tid] += omp_get_wtime() - start_time;
+    _thread_num_segments[tid] += 2 * num_segments;
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Computes the contribution to the FSR scalar flux from a Track
+ *        segment for a block of energy groups.
+ * @details The angular flux is integrated in the same order of energy
+ *          groups and polar angles as by the CPUSolver, such that the
+ *          scalar fluxes are identical.
+ * @param curr_segment a pointer to the Track segment of interest
+ * @param azim_index the azimuthal angle index for this segment
+ * @param track_flux a pointer to the Track's angular flux for the block
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ * @param g0 the first energy group of the block
+ * @param num_block_groups the number of energy groups in the block
+ */
+void GroupBlockedSolver::scalarFluxTallyBlock(segment* curr_segment,
+                                              int azim_index,
+                                              FP_PRECISION* track_flux,
+                                              FP_PRECISION* fsr_flux,
+                                              int g0, int num_block_groups) {
+
+  int fsr_id = curr_segment->_region_id;
+  FP_PRECISION length = curr_segment->_length;
+  FP_PRECISION* sigma_t = &_FSR_materials[fsr_id]->getSigmaT()[g0];
+  FP_PRECISION* reduced_source =
+       &_blocked_reduced_source(g0,num_block_groups,fsr_id,0);
+  FP_PRECISION* polar_weights = &_polar_weights(azim_index,0);
+
+  /* The change in angular flux along this Track segment in the FSR */
+  FP_PRECISION delta_psi;
+  FP_PRECISION exponential;
+
+  /* Use the exponentials from the cache if this segment was cached */
+  FP_PRECISION* exponentials = getCachedExponentials(curr_segment);
+
+  if (exponentials != NULL) {
+
+    exponentials = &exponentials[g0];
+
+    for (int p=0; p < _num_polar; p++){
+      for (int e=0; e < num_block_groups; e++) {
+        delta_psi = (track_flux[p*num_block_groups+e] - reduced_source[e]) *
+                    exponentials[p*_num_groups+e];
+        fsr_flux[e] += delta_psi * polar_weights[p];
+        track_flux[p*num_block_groups+e] -= delta_psi;
+      }
+    }
+
+    return;
+  }
+
+  for (int e=0; e < num_block_groups; e++) {
+    for (int p=0; p < _num_polar; p++){
+      exponential = CPUSolver::computeExponential(sigma_t[e], length, p);
+      delta_psi = (track_flux[p*num_block_groups+e] - reduced_source[e]) *
+                  exponential;
+      fsr_flux[e] += delta_psi * polar_weights[p];
+      track_flux[p*num_block_groups+e] -= delta_psi;
+    }
+  }
+}
+
+
+/**
+ * @brief Flushes a thread's temporary FSR scalar flux buffer to the scalar
+ *        flux of a block of energy groups and zeroes the buffer.
+ * @details The buffer is added with the flux accumulation scheme in use, or
+ *          with plain additions for the COLORED_SWEEP sweep type.
+ * @param fsr_id the ID for the FSR of interest
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ * @param g0 the first energy group of the block
+ * @param num_block_groups the number of energy groups in the block
+ */
+void GroupBlockedSolver::accumulateScalarFluxBlock(int fsr_id,
+                                                   FP_PRECISION* fsr_flux,
+                                                   int g0,
+                                                   int num_block_groups) {
+
+  FP_PRECISION* scalar_flux =
+       &_blocked_scalar_flux(g0,num_block_groups,fsr_id,0);
+
+  /* Increment the FSR scalar flux without any synchronization */
+  if (_sweep_type == COLORED_SWEEP) {
+    for (int e=0; e < num_block_groups; e++) {
+      scalar_flux[e] += fsr_flux[e];
+      fsr_flux[e] = 0.0;
+    }
+  }
+
+  /* Atomically increment each energy group without any locks */
+  else if (_accumulation_type == ATOMICS) {
+    for (int e=0; e < num_block_groups; e++) {
+      #pragma omp atomic
+      scalar_flux[e] += fsr_flux[e];
+      fsr_flux[e] = 0.0;
+    }
+  }
+
+  /* Atomically increment the FSR scalar flux from the temporary array
+   * using the FSR's (or FSR stripe's) mutual exclusion lock */
+  else {
+    omp_lock_t* lock = &_FSR_locks[fsr_id % _num_FSR_locks];
+
+    omp_set_lock(lock);
+    {
+      for (int e=0; e < num_block_groups; e++)
+        scalar_flux[e] += fsr_flux[e];
+    }
+    omp_unset_lock(lock);
+
+    memset(fsr_flux, 0, num_block_groups * sizeof(FP_PRECISION));
+  }
+}
+
+
+/**
+ * @brief Updates the boundary flux of a block of energy groups for a Track
+ *        given boundary conditions.
+ * @details The leakage is stored with the layout of the CPUSolver, such
+ *          that it is reduced in the same order for \f$ k_{eff} \f$.
+ * @param track_id the ID number for the Track of interest
+ * @param azim_index the azimuthal angle index for this Track
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @param track_flux a pointer to the Track's outgoing angular flux for the
+ *        block
+ * @param g0 the first energy group of the block
+ * @param num_block_groups the number of energy groups in the block
+ */
+void GroupBlockedSolver::transferBoundaryFluxBlock(int track_id,
+                                                   int azim_index,
+                                                   bool direction,
+                                                   FP_PRECISION* track_flux,
+                                                   int g0,
+                                                   int num_block_groups) {
+
+  int start;
+  int bc;
+  FP_PRECISION* track_leakage;
+  int track_out_id;
+  FP_PRECISION* polar_weights = &_polar_weights(azim_index,0);
+
+  /* For the "forward" direction */
+  if (direction) {
+    start = _tracks[track_id]->isReflOut();
+    bc = (int)_tracks[track_id]->getBCOut();
+    track_leakage = &_boundary_leakage(track_id,g0);
+    track_out_id = _tracks[track_id]->getTrackOut()->getUid();
+  }
+
+  /* For the "reverse" direction */
+  else {
+    start = _tracks[track_id]->isReflIn();
+    bc = (int)_tracks[track_id]->getBCIn();
+    track_leakage = &_boundary_leakage(track_id,_polar_times_groups+g0);
+    track_out_id = _tracks[track_id]->getTrackIn()->getUid();
+  }
+
+  FP_PRECISION* track_out_flux =
+       &_blocked_boundary_flux(g0,num_block_groups,track_out_id,start,0);
+
+  /* Loop over polar angles and energy groups */
+  for (int p=0; p < _num_polar; p++) {
+    for (int e=0; e < num_block_groups; e++) {
+      track_out_flux[p*num_block_groups+e] =
+           track_flux[p*num_block_groups+e] * bc;
+      track_leakage[p*_num_groups+e] = track_flux[p*num_block_groups+e] *
+                                       polar_weights[p] * (!bc);
+    }
+  }
+}
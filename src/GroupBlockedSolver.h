@@ -0,0 +1,116 @@
+/**
+ * @file GroupBlockedSolver.h
+ * @brief The GroupBlockedSolver class.
+ * @date October 17, 2026
+ */
+
+
+#ifndef GROUPBLOCKEDSOLVER_H_
+#define GROUPBLOCKEDSOLVER_H_
+
+#ifdef __cplusplus
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <omp.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include "CPUSolver.h"
+#endif
+
+/** The default size (bytes) of the cache for each thread's block of groups
+ *  if it cannot be queried from the operating system */
+#define GROUP_BLOCK_CACHE_SIZE (256*1024)
+
+/** Indexing macro for the angular fluxes for each polar angle and energy
+ *  group (pe) in a block of groups starting at group g0 with B groups in
+ *  both directions for a given Track */
+#define _blocked_boundary_flux(g0,B,i,j,pe) (_boundary_flux[(long)_num_polar*(2*(long)_tot_num_tracks*(g0) + (2*(i) + (j))*(B)) + (pe)])
+
+/** Indexing macro for the scalar flux in each FSR and energy group in a
+ *  block of groups starting at group g0 with B groups */
+#define _blocked_scalar_flux(g0,B,r,e) (_blocked_scalar_flux[(long)_num_FSRs*(g0) + (r)*(B) + (e)])
+
+/** Indexing macro for the source divided by the total cross-section in
+ *  each FSR and energy group in a block of groups starting at group g0 with
+ *  B groups */
+#define _blocked_reduced_source(g0,B,r,e) (_blocked_reduced_source[(long)_num_FSRs*(g0) + (r)*(B) + (e)])
+
+
+/**
+ * @class GroupBlockedSolver GroupBlockedSolver.h "src/GroupBlockedSolver.h"
+ * @brief This is a subclass of the CPUSolver which sweeps all Tracks for
+ *        one block of energy groups at a time.
+ * @details For large group structures, the scalar fluxes and sources of the
+ *          FSRs crossed by the Tracks do not fit in cache for all groups.
+ *          The groups are split into blocks whose FSR scalar fluxes and
+ *          sources fit in the cache of each thread, and all Tracks are swept
+ *          for each block in turn. The Track boundary fluxes and the FSR
+ *          scalar fluxes and sources swept are stored group-block-major,
+ *          such that the values for a block are contiguous. Since the
+ *          sources are fixed within a transport sweep, the scalar fluxes are
+ *          identical to those of the CPUSolver. The HALFSPACE_SWEEP,
+ *          COLORED_SWEEP and PARTITIONED_SWEEP sweep types are supported,
+ *          without CMFD acceleration or single precision boundary fluxes.
+ */
+class GroupBlockedSolver : public CPUSolver {
+
+protected:
+
+  /** The number of energy groups per block requested (0 to choose it from
+   *  the cache size) */
+  int _requested_group_block_size;
+
+  /** The size (bytes) of the cache for each thread (0 to query it) */
+  long _group_block_cache_size;
+
+  /** The number of blocks of energy groups */
+  int _num_group_blocks;
+
+  /** The first energy group of each block and the number of groups */
+  int* _group_block_offsets;
+
+  /** The FSR scalar fluxes for each block of groups, FSR and energy group
+   *  in the block */
+  FP_PRECISION* _blocked_scalar_flux;
+
+  /** The FSR sources divided by the total cross-section for each block of
+   *  groups, FSR and energy group in the block */
+  FP_PRECISION* _blocked_reduced_source;
+
+  void initializeFluxArrays();
+  void initializeSourceArrays();
+  void initializeCmfd();
+  void initializeGroupBlocks();
+  long getBlockedBoundaryFluxIndex(long index);
+  void getCheckpointArray(checkpointArray array, long offset, long length,
+                          FP_PRECISION* values);
+  void setCheckpointArray(checkpointArray array, long offset, long length,
+                          FP_PRECISION* values);
+
+  void scalarFluxTallyBlock(segment* curr_segment, int azim_index,
+                            FP_PRECISION* track_flux, FP_PRECISION* fsr_flux,
+                            int g0, int num_block_groups);
+  void transferBoundaryFluxBlock(int track_id, int azim_index, bool direction,
+                                 FP_PRECISION* track_flux, int g0,
+                                 int num_block_groups);
+  void accumulateScalarFluxBlock(int fsr_id, FP_PRECISION* fsr_flux, int g0,
+                                 int num_block_groups);
+  void sweepTrackBlock(int track_id, int g0, int num_block_groups);
+  void transportSweep();
+
+public:
+  GroupBlockedSolver(Geometry* geometry=NULL,
+                     TrackGenerator* track_generator=NULL, Cmfd* cmfd=NULL);
+  virtual ~GroupBlockedSolver();
+
+  int getGroupBlockSize();
+  int getNumGroupBlocks();
+  long getGroupBlockCacheSize();
+
+  void setGroupBlockSize(int group_block_size);
+  void setGroupBlockCacheSize(long cache_size);
+};
+
+
+#endif /* GROUPBLOCKEDSOLVER_H_ */
@@ -44,6 +44,7 @@ Mesh::Mesh(solveType solve_type, bool cmfd_on,
   _bounds_y = NULL;
   _lengths_x = NULL;
   _lengths_y = NULL;
+  _fsr_indices = NULL;
 
 }
 
@@ -73,6 +74,9 @@ Mesh::~Mesh(){
   if (_lengths_y != NULL)
     delete [] _lengths_y;
 
+  if (_fsr_indices != NULL)
+    delete [] _fsr_indices;
+
 }
 
 
@@ -245,6 +249,10 @@ void Mesh::setFSRBounds(){
   int max;
   std::vector<int>::iterator iter;
 
+  /* Delete the FSR bounds if the FSRs have been renumbered */
+  if (_fsr_indices != NULL)
+    delete [] _fsr_indices;
+
   /* Create arrays of FSR indices, cell bounds, and surfaces */
   try{
     _fsr_indices = new int[2 * _num_x * _num_y];
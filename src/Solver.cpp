@@ -1,6 +1,31 @@
 #include "Solver.h"
 
 
+/** The offset basis of the 64-bit FNV-1a hash */
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+
+/** The prime of the 64-bit FNV-1a hash */
+#define FNV_PRIME 1099511628211ULL
+
+
+/**
+ * @brief Adds an array of bytes to a 64-bit FNV-1a hash.
+ * @param hash the hash of the preceding bytes
+ * @param data a pointer to the bytes
+ * @param size the number of bytes
+ * @return the hash including the bytes
+ */
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+
+  const unsigned char* bytes = (const unsigned char*)data;
+
+  for (size_t i=0; i < size; i++)
+    hash = (hash ^ bytes[i]) * FNV_PRIME;
+
+  return hash;
+}
+
+
 /**
  * @brief Constructor initializes an empty Solver class with array pointers
  *        set to NULL.
@@ -47,8 +72,19 @@ Solver::Solver(Geometry* geometry, TrackGenerator* track_generator,
   _source_residuals = NULL;
 
   _interpolate_exponential = true;
+  _polynomial_exponential = false;
+  _exp_poly_degree = 0;
   _exp_table = NULL;
 
+  _checkpoint_interval = 0;
+
+  _sweep_report = false;
+  _num_report_threads = 0;
+  _thread_num_segments = NULL;
+  _thread_busy_times = NULL;
+  _sweep_start_time = 0.;
+  _sweep_time = 0.;
+
   if (geometry != NULL)
     setGeometry(geometry);
 
@@ -68,6 +104,8 @@ Solver::Solver(Geometry* geometry, TrackGenerator* track_generator,
   _converged_source = false;
 
   _timer = new Timer();
+  _count_tlb_misses = false;
+  _num_tlb_misses = -1;
 
 }
 
@@ -119,6 +157,12 @@ Solver::~Solver() {
 
   if (_quad != NULL)
     delete _quad;
+
+  if (_thread_num_segments != NULL)
+    delete [] _thread_num_segments;
+
+  if (_thread_busy_times != NULL)
+    delete [] _thread_busy_times;
 }
 
 
@@ -186,6 +230,21 @@ double Solver::getTotalTime() {
 }
 
 
+/**
+ * @brief Returns the data TLB misses of all threads during the source
+ *        iterations to converge the source.
+ * @details The TLB misses are counted with hardware counters if requested
+ *          with Solver::setCountTLBMisses(...), which may be used to compare
+ *          the source iterations with and without huge pages backing the
+ *          segments and boundary fluxes.
+ * @return the number of data TLB misses (-1 if they were not or could not
+ *         be counted)
+ */
+long Solver::getNumTLBMisses() {
+  return _num_tlb_misses;
+}
+
+
 /**
  * @brief Returns the converged eigenvalue \f$ k_{eff} \f$.
  * @return the converged eigenvalue \f$ k_{eff} \f$
@@ -204,6 +263,92 @@ FP_PRECISION Solver::getSourceConvergenceThreshold() {
 }
 
 
+/**
+ * @brief Returns the number of threads in the report of the last transport
+ *        sweep.
+ * @return the number of threads (0 if no sweep has been reported)
+ */
+int Solver::getNumReportThreads() {
+  return _num_report_threads;
+}
+
+
+/**
+ * @brief Returns the number of segments swept by a thread in both
+ *        directions in the last transport sweep.
+ * @param thread the thread of interest
+ * @return the number of segments swept by the thread
+ */
+long Solver::getThreadNumSegments(int thread) {
+
+  if (thread < 0 || thread >= _num_report_threads)
+    log_printf(ERROR, "Unable to return the number of segments swept by "
+               "thread %d since %d threads were reported for the last "
+               "transport sweep", thread, _num_report_threads);
+
+  return _thread_num_segments[thread];
+}
+
+
+/**
+ * @brief Returns the time spent by a thread sweeping Tracks in the last
+ *        transport sweep.
+ * @param thread the thread of interest
+ * @return the busy time of the thread (seconds)
+ */
+double Solver::getThreadBusyTime(int thread) {
+
+  if (thread < 0 || thread >= _num_report_threads)
+    log_printf(ERROR, "Unable to return the busy time of thread %d since "
+               "%d threads were reported for the last transport sweep",
+               thread, _num_report_threads);
+
+  return _thread_busy_times[thread];
+}
+
+
+/**
+ * @brief Returns the time a thread was not sweeping Tracks during the last
+ *        transport sweep.
+ * @details This is the time spent by the thread waiting for other threads at
+ *          the end of each azimuthal angle halfspace or Track color, and in
+ *          the scheduling of the Tracks.
+ * @param thread the thread of interest
+ * @return the idle time of the thread (seconds)
+ */
+double Solver::getThreadIdleTime(int thread) {
+  return _sweep_time - getThreadBusyTime(thread);
+}
+
+
+/**
+ * @brief Returns the load imbalance of the last transport sweep.
+ * @details The load imbalance is the maximum busy time of any thread
+ *          divided by the mean busy time of the threads, such that 1 is
+ *          a perfectly balanced sweep.
+ * @return the load imbalance of the last transport sweep
+ */
+double Solver::getSweepLoadImbalance() {
+
+  if (_num_report_threads == 0)
+    log_printf(ERROR, "Unable to return the load imbalance since no "
+               "transport sweep has been reported");
+
+  double max_busy_time = 0.;
+  double tot_busy_time = 0.;
+
+  for (int t=0; t < _num_report_threads; t++) {
+    max_busy_time = std::max(max_busy_time, _thread_busy_times[t]);
+    tot_busy_time += _thread_busy_times[t];
+  }
+
+  if (tot_busy_time <= 0.)
+    return 1.;
+
+  return max_busy_time * _num_report_threads / tot_busy_time;
+}
+
+
 /**
  * @brief Returns whether the Solver is using single floating point precision.
  * @return true if so, false otherwise
@@ -254,7 +399,19 @@ bool Solver::isUsingExponentialInterpolation() {
  * @return true if so, false otherwise
  */
 bool Solver::isUsingExponentialIntrinsic() {
-  return !_interpolate_exponential;
+  return !_interpolate_exponential && !_polynomial_exponential;
+}
+
+
+/**
+ * @brief Returns whether the Solver uses a polynomial to compute
+ *        exponentials.
+ * @details The Solver::useExponentialPolynomial() routine can be called to
+ *          use a polynomial approximation instead of linear interpolation.
+ * @return true if so, false otherwise
+ */
+bool Solver::isUsingExponentialPolynomial() {
+  return _polynomial_exponential;
 }
 
 
@@ -399,6 +556,7 @@ void Solver::setSourceConvergenceThreshold(FP_PRECISION source_thresh) {
  */
 void Solver::useExponentialInterpolation() {
   _interpolate_exponential = true;
+  _polynomial_exponential = false;
 }
 
 
@@ -408,6 +566,113 @@ void Solver::useExponentialInterpolation() {
  */
 void Solver::useExponentialIntrinsic() {
   _interpolate_exponential = false;
+  _polynomial_exponential = false;
+}
+
+
+/**
+ * @brief Informs the Solver to use a polynomial to compute the exponential
+ *        in the transport equation.
+ * @details The polynomial is valid for any optical length and its degree is
+ *          chosen such that its error is bounded by the same tolerance as
+ *          the linear interpolation table. Since it has no table lookups,
+ *          it may be vectorized by the compiler. Segments need not be split
+ *          for the polynomial, which may be turned off with the
+ *          TrackGenerator::setSegmentSplitting(...) routine.
+ */
+void Solver::useExponentialPolynomial() {
+  _interpolate_exponential = false;
+  _polynomial_exponential = true;
+}
+
+
+/**
+ * @brief Sets a file to write a checkpoint of the Solver's state to every
+ *        few source iterations.
+ * @details Each checkpoint is written to a temporary file which then
+ *          replaces the checkpoint file, such that the last checkpoint is
+ *          intact if the simulation is interrupted while writing the next.
+ *          Source convergence may be resumed from the checkpoint with
+ *          Solver::setRestartFile(...). Checkpoints may be written every
+ *          50 iterations from Python as follows:
+ *
+ * @code
+ *          solver.setCheckpointFile('checkpoint.data', 50)
+ * @endcode
+ *
+ * @param filename the name of the checkpoint file
+ * @param interval the number of iterations between checkpoints (0 for none)
+ */
+void Solver::setCheckpointFile(const char* filename, int interval) {
+
+  if (interval < 0)
+    log_printf(ERROR, "Unable to set the checkpoint interval to %d since "
+               "it is negative", interval);
+
+  _checkpoint_file = filename;
+  _checkpoint_interval = interval;
+}
+
+
+/**
+ * @brief Sets a checkpoint file to resume source convergence from.
+ * @details The scalar fluxes, boundary angular fluxes, sources and
+ *          \f$ k_{eff} \f$ are read from the checkpoint instead of the
+ *          initial flat source guess each time the source is converged.
+ *          The checkpoint must have been written for the same Geometry and
+ *          Tracks. An empty file name starts from a flat source:
+ *
+ * @code
+ *          solver.setRestartFile('checkpoint.data')
+ *          solver.convergeSource(max_iters)
+ * @endcode
+ *
+ * @param filename the name of the checkpoint file
+ */
+void Solver::setRestartFile(const char* filename) {
+  _restart_file = filename;
+}
+
+
+/**
+ * @brief Sets whether to record the work of each thread in each transport
+ *        sweep.
+ * @details The number of segments swept and the time spent sweeping Tracks
+ *          are recorded for each thread, and the load imbalance of each
+ *          sweep is logged at the INFO level. The report of the last sweep
+ *          may be printed from Python as follows:
+ *
+ * @code
+ *          solver.setSweepReport(True)
+ *          solver.convergeSource(max_iters)
+ *          solver.printSweepReport()
+ * @endcode
+ *
+ * @param sweep_report whether to report each transport sweep
+ */
+void Solver::setSweepReport(bool sweep_report) {
+  _sweep_report = sweep_report;
+}
+
+
+/**
+ * @brief Sets whether to count the data TLB misses of all threads during
+ *        the source iterations.
+ * @details The misses are counted with a hardware counter for each thread,
+ *          which is closed once the source has converged. The misses per
+ *          segment are included in the timer report, and may be compared
+ *          with and without huge pages from Python as follows:
+ *
+ * @code
+ *          solver.setCountTLBMisses(True)
+ *          solver.convergeSource(max_iters)
+ *          solver.printTimerReport()
+ * @endcode
+ *
+ * @param count_tlb_misses whether to count the data TLB misses
+ */
+void Solver::setCountTLBMisses(bool count_tlb_misses) {
+  _count_tlb_misses = count_tlb_misses;
 }
 
 
@@ -526,13 +791,6 @@ FP_PRECISION Solver::convergeSource(int max_iterations) {
   /* An initial guess for the eigenvalue */
   _k_eff = 1.0;
 
-  /* The residual on the source */
-  FP_PRECISION residual = 0.0;
-
-  /* The old residual and k_eff */
-  FP_PRECISION residual_old = 1.0;
-  FP_PRECISION keff_old = 1.0;
-
   /* Initialize data structures */
   initializePolarQuadrature();
   initializeFluxArrays();
@@ -547,43 +805,167 @@ FP_PRECISION Solver::convergeSource(int max_iterations) {
   /* Check that each FSR has at least one segment crossing it */
   checkTrackSpacing();
 
+  /* Record the cross-sections for which the source is converged */
+  recordMaterialFingerprints();
+
   /* Set scalar flux to unity for each region */
   flattenFSRFluxes(1.0);
   flattenFSRSources(1.0);
   zeroTrackFluxes();
 
+  /* Resume from the state of a previous simulation if requested */
+  if (!_restart_file.empty())
+    readCheckpoint(_restart_file.c_str());
+
+  _num_tlb_misses = -1;
+
+  if (_count_tlb_misses)
+    start_tlb_miss_count();
+
+  iterateSource(max_iterations);
+
+  if (_count_tlb_misses)
+    _num_tlb_misses = stop_tlb_miss_count();
+
+  _timer->stopTimer();
+  _timer->recordSplit("Total time to converge the source");
+
+  return _k_eff;
+}
+
+
+/**
+ * @brief Recomputes keff after the cross-sections of some Materials have
+ *        changed since the source was last converged.
+ * @details Only the data which depends on the cross-sections is refreshed,
+ *          and source iteration is warm started from the previous fluxes
+ *          and eigenvalue. The quadrature, flux and source arrays and FSR
+ *          volumes and Materials are reused, so the Geometry, Tracks and
+ *          the Materials filling each FSR must not have changed. The CMFD
+ *          cross-sections are homogenized from the FSR Materials on each
+ *          iteration and need not be refreshed. This is intended for
+ *          studies which perturb the cross-sections of a few Materials,
+ *          for example from Python as follows:
+ *
+ * @code
+ *          solver.convergeSource(max_iters)
+ *          fuel.setSigmaT(perturbed_sigma_t)
+ *          solver.resolve(max_iters)
+ * @endcode
+ *
+ * @param max_iterations the maximum number of source iterations to allow
+ * @return the value of the computed eigenvalue \f$ k_{eff} \f$
+ */
+FP_PRECISION Solver::resolve(int max_iterations) {
+
+  /* Converge the source from scratch if it was not converged before */
+  if (_material_fingerprints.empty())
+    return convergeSource(max_iterations);
+
+  log_printf(NORMAL, "Reconverging the source...");
+
+  clearTimerSplits();
+  _timer->startTimer();
+
+  /* Find the Materials whose cross-sections have changed */
+  std::vector<Material*> materials;
+  std::map<int, Material*> all_materials = _geometry->getMaterials();
+  std::map<int, Material*>::iterator iter;
+
+  for (iter=all_materials.begin(); iter != all_materials.end(); ++iter) {
+    Material* material = iter->second;
+    if (computeMaterialFingerprint(material) !=
+        _material_fingerprints[material->getUid()])
+      materials.push_back(material);
+  }
+
+  log_printf(INFO, "The cross-sections of %d Materials have changed",
+             (int)materials.size());
+
+  if (!materials.empty()) {
+    updateMaterials(materials);
+    recordMaterialFingerprints();
+  }
+
+  _num_iterations = 0;
+  _num_tlb_misses = -1;
+
+  if (_count_tlb_misses)
+    start_tlb_miss_count();
+
+  iterateSource(max_iterations);
+
+  if (_count_tlb_misses)
+    _num_tlb_misses = stop_tlb_miss_count();
+
+  _timer->stopTimer();
+  _timer->recordSplit("Total time to converge the source");
+
+  return _k_eff;
+}
+
+
+/**
+ * @brief Performs one source iteration.
+ * @details The fluxes are normalized, the sources are computed from them
+ *          and the Tracks are swept, after which the scalar fluxes are
+ *          accelerated with CMFD if requested and \f$ k_{eff} \f$ is
+ *          updated. Subclasses may override this to schedule these steps
+ *          differently, such as within a single parallel region.
+ * @return the residual between this source and the previous source
+ */
+FP_PRECISION Solver::sourceIteration() {
+
+  normalizeFluxes();
+
+  FP_PRECISION residual = computeFSRSources();
+  transportSweep();
+  addSourceToScalarFlux();
+
+  /* Update the flux with cmfd */
+  if (_cmfd->getMesh()->getAcceleration()){
+    _k_eff = _cmfd->computeKeff();
+  }
+
+  computeKeff();
+
+  return residual;
+}
+
+
+/**
+ * @brief Performs source iterations from the current fluxes, sources and
+ *        eigenvalue until the source converges.
+ * @details This method is for internal use only and is called by the
+ *          Solver::convergeSource() and Solver::resolve() methods.
+ * @param max_iterations the maximum number of source iterations to allow
+ * @return the value of the computed eigenvalue \f$ k_{eff} \f$
+ */
+FP_PRECISION Solver::iterateSource(int max_iterations) {
+
+  /* The residual on the source */
+  FP_PRECISION residual = 0.0;
+
   /* Source iteration loop */
   for (int i=0; i < max_iterations; i++) {
 
     log_printf(NORMAL, "Iteration %d: \tk_eff = %1.6f"
                "\tres = %1.3E", i, _k_eff, residual);
 
-    normalizeFluxes();
-
-    residual = computeFSRSources();
-    transportSweep();
-    addSourceToScalarFlux();
-
-    /* Update the flux with cmfd */
-    if (_cmfd->getMesh()->getAcceleration()){
-      _k_eff = _cmfd->computeKeff();
-    }
-
-    computeKeff();
+    residual = sourceIteration();
 
     _num_iterations++;
 
+    /* Write a checkpoint of the Solver's state if requested */
+    if (_checkpoint_interval > 0 &&
+        _num_iterations % _checkpoint_interval == 0)
+      writeCheckpoint(_checkpoint_file.c_str());
+
     /* Check for convergence of the fission source distribution */
-    if (i > 1 && residual < _source_convergence_thresh) {
-      _timer->stopTimer();
-      _timer->recordSplit("Total time to converge the source");
+    if (i > 1 && residual < _source_convergence_thresh)
       return _k_eff;
-    }
   }
 
-  _timer->stopTimer();
-  _timer->recordSplit("Total time to converge the source");
-
   log_printf(WARNING, "Unable to converge the source after %d iterations",
              max_iterations);
 
@@ -591,6 +973,362 @@ FP_PRECISION Solver::convergeSource(int max_iterations) {
 }
 
 
+/**
+ * @brief Writes a binary checkpoint of the Solver's state to a file.
+ * @details The checkpoint stores \f$ k_{eff} \f$, the number of source
+ *          iterations, and the scalar fluxes, previous sources and boundary
+ *          angular fluxes from the last source iteration. A fingerprint of
+ *          the Geometry and Tracks is stored to validate that the checkpoint
+ *          is read for the same problem. The arrays are streamed to the file
+ *          in chunks of CHECKPOINT_CHUNK_SIZE values such that only a small
+ *          buffer is needed. The CMFD Mesh fluxes are not stored since they
+ *          are computed from the FSR scalar fluxes on each iteration. This
+ *          may be called from Python once the source has been converged:
+ *
+ * @code
+ *          solver.convergeSource(max_iters)
+ *          solver.writeCheckpoint('checkpoint.data')
+ * @endcode
+ *
+ * @param filename the name of the checkpoint file
+ */
+void Solver::writeCheckpoint(const char* filename) {
+
+  if (_scalar_flux == NULL || _old_source == NULL)
+    log_printf(ERROR, "Unable to write a checkpoint to %s since the source "
+               "has not yet been converged", filename);
+
+  log_printf(INFO, "Writing a checkpoint to %s...", filename);
+
+  /* Write to a temporary file to keep any previous checkpoint intact */
+  std::string temp_filename = std::string(filename) + ".tmp";
+  FILE* out = fopen(temp_filename.c_str(), "wb");
+
+  if (out == NULL)
+    log_printf(ERROR, "Unable to open the checkpoint file %s",
+               temp_filename.c_str());
+
+  /* Write the header */
+  char magic[8] = {'O', 'P', 'E', 'N', 'M', 'O', 'C', 'C'};
+  int version = CHECKPOINT_VERSION;
+  int precision = sizeof(FP_PRECISION);
+  uint64_t fingerprint = computeCheckpointFingerprint();
+  double k_eff = _k_eff;
+
+  fwrite(magic, sizeof(char), 8, out);
+  fwrite(&version, sizeof(int), 1, out);
+  fwrite(&precision, sizeof(int), 1, out);
+  fwrite(&fingerprint, sizeof(uint64_t), 1, out);
+  fwrite(&_num_iterations, sizeof(int), 1, out);
+  fwrite(&k_eff, sizeof(double), 1, out);
+
+  /* Stream each array to the file in chunks */
+  FP_PRECISION* buffer = new FP_PRECISION[CHECKPOINT_CHUNK_SIZE];
+  checkpointArray arrays[3] = {CHECKPOINT_SCALAR_FLUX, CHECKPOINT_OLD_SOURCE,
+                               CHECKPOINT_BOUNDARY_FLUX};
+  bool success = true;
+
+  for (int i=0; i < 3; i++) {
+    long size = getCheckpointArraySize(arrays[i]);
+    fwrite(&size, sizeof(long), 1, out);
+
+    for (long offset=0; offset < size; offset += CHECKPOINT_CHUNK_SIZE) {
+      long length = std::min(size - offset, (long)CHECKPOINT_CHUNK_SIZE);
+      getCheckpointArray(arrays[i], offset, length, buffer);
+
+      if (fwrite(buffer, sizeof(FP_PRECISION), length, out) != (size_t)length)
+        success = false;
+    }
+  }
+
+  delete [] buffer;
+
+  if (fclose(out) != 0 || !success)
+    log_printf(ERROR, "Unable to write the checkpoint file %s",
+               temp_filename.c_str());
+
+  /* Replace the previous checkpoint */
+  if (rename(temp_filename.c_str(), filename) != 0)
+    log_printf(ERROR, "Unable to rename the checkpoint file %s to %s",
+               temp_filename.c_str(), filename);
+}
+
+
+/**
+ * @brief Reads a binary checkpoint of the Solver's state from a file.
+ * @details The checkpoint must have been written by
+ *          Solver::writeCheckpoint(...) for the same Geometry and Tracks
+ *          in the same floating point precision. This is called by
+ *          Solver::convergeSource(...) for a file set with
+ *          Solver::setRestartFile(...) after the Solver's arrays have been
+ *          initialized, but may also be called from Python to restore the
+ *          fluxes of a previous simulation once the source is converged.
+ * @param filename the name of the checkpoint file
+ */
+void Solver::readCheckpoint(const char* filename) {
+
+  if (_scalar_flux == NULL || _old_source == NULL)
+    log_printf(ERROR, "Unable to read a checkpoint from %s since the "
+               "Solver's arrays have not yet been initialized", filename);
+
+  log_printf(NORMAL, "Reading a checkpoint from %s...", filename);
+
+  FILE* in = fopen(filename, "rb");
+
+  if (in == NULL)
+    log_printf(ERROR, "Unable to open the checkpoint file %s", filename);
+
+  /* Read and validate the header */
+  char magic[8];
+  int version;
+  int precision;
+  uint64_t fingerprint;
+  int num_iterations;
+  double k_eff;
+  bool success = true;
+
+  success &= fread(magic, sizeof(char), 8, in) == 8;
+  success &= fread(&version, sizeof(int), 1, in) == 1;
+  success &= fread(&precision, sizeof(int), 1, in) == 1;
+  success &= fread(&fingerprint, sizeof(uint64_t), 1, in) == 1;
+  success &= fread(&num_iterations, sizeof(int), 1, in) == 1;
+  success &= fread(&k_eff, sizeof(double), 1, in) == 1;
+
+  if (!success || strncmp(magic, "OPENMOCC", 8) != 0)
+    log_printf(ERROR, "Unable to read the checkpoint file %s since it is "
+               "not an OpenMOC checkpoint", filename);
+
+  if (version != CHECKPOINT_VERSION)
+    log_printf(ERROR, "Unable to read the checkpoint file %s with version "
+               "%d since the Solver reads version %d", filename, version,
+               CHECKPOINT_VERSION);
+
+  if (precision != sizeof(FP_PRECISION))
+    log_printf(ERROR, "Unable to read the checkpoint file %s with %d byte "
+               "floating point values since the Solver uses %d bytes",
+               filename, precision, (int)sizeof(FP_PRECISION));
+
+  if (fingerprint != computeCheckpointFingerprint())
+    log_printf(ERROR, "Unable to read the checkpoint file %s since it was "
+               "written for a different Geometry or Tracks", filename);
+
+  /* Stream each array from the file in chunks */
+  FP_PRECISION* buffer = new FP_PRECISION[CHECKPOINT_CHUNK_SIZE];
+  checkpointArray arrays[3] = {CHECKPOINT_SCALAR_FLUX, CHECKPOINT_OLD_SOURCE,
+                               CHECKPOINT_BOUNDARY_FLUX};
+
+  for (int i=0; i < 3; i++) {
+    long size;
+    success &= fread(&size, sizeof(long), 1, in) == 1;
+
+    if (!success || size != getCheckpointArraySize(arrays[i]))
+      log_printf(ERROR, "Unable to read the checkpoint file %s since its "
+                 "arrays do not match the Solver's arrays", filename);
+
+    for (long offset=0; offset < size; offset += CHECKPOINT_CHUNK_SIZE) {
+      long length = std::min(size - offset, (long)CHECKPOINT_CHUNK_SIZE);
+
+      if (fread(buffer, sizeof(FP_PRECISION), length, in) != (size_t)length)
+        log_printf(ERROR, "Unable to read the checkpoint file %s since it "
+                   "is truncated", filename);
+
+      setCheckpointArray(arrays[i], offset, length, buffer);
+    }
+  }
+
+  delete [] buffer;
+  fclose(in);
+
+  _k_eff = k_eff;
+  _num_iterations = num_iterations;
+
+  log_printf(NORMAL, "Resuming from iteration %d with k_eff = %1.6f",
+             num_iterations, k_eff);
+}
+
+
+/**
+ * @brief Returns the number of values in an array stored in a checkpoint.
+ * @param array the checkpoint array
+ * @return the number of values in the array
+ */
+long Solver::getCheckpointArraySize(checkpointArray array) {
+
+  if (array == CHECKPOINT_BOUNDARY_FLUX)
+    return 2 * (long)_tot_num_tracks * _polar_times_groups;
+  else
+    return (long)_num_FSRs * _num_groups;
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint to a buffer.
+ * @details Solver subclasses which do not store the arrays in host memory
+ *          in the Solver's floating point precision override this method.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values to
+ */
+void Solver::getCheckpointArray(checkpointArray array, long offset,
+                                long length, FP_PRECISION* values) {
+
+  FP_PRECISION* data;
+
+  if (array == CHECKPOINT_SCALAR_FLUX)
+    data = _scalar_flux;
+  else if (array == CHECKPOINT_OLD_SOURCE)
+    data = _old_source;
+  else
+    data = _boundary_flux;
+
+  memcpy(values, &data[offset], length * sizeof(FP_PRECISION));
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint from a buffer.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values from
+ */
+void Solver::setCheckpointArray(checkpointArray array, long offset,
+                                long length, FP_PRECISION* values) {
+
+  FP_PRECISION* data;
+
+  if (array == CHECKPOINT_SCALAR_FLUX)
+    data = _scalar_flux;
+  else if (array == CHECKPOINT_OLD_SOURCE)
+    data = _old_source;
+  else
+    data = _boundary_flux;
+
+  memcpy(&data[offset], values, length * sizeof(FP_PRECISION));
+}
+
+
+/**
+ * @brief Computes a fingerprint of the Geometry and Tracks for a checkpoint.
+ * @details The fingerprint is a 64-bit FNV-1a hash of the numbers of FSRs,
+ *          energy groups, azimuthal and polar angles and Tracks and of the
+ *          length and FSR of each Track segment. Checkpoints are only read
+ *          for the same fingerprint, such that the fluxes of each FSR and
+ *          Track are restored to the same FSR and Track.
+ * @return the fingerprint
+ */
+uint64_t Solver::computeCheckpointFingerprint() {
+
+  uint64_t hash = FNV_OFFSET_BASIS;
+  int sizes[5] = {_num_FSRs, _num_groups, _num_azim, _num_polar,
+                  _tot_num_tracks};
+  hash = hash_bytes(hash, sizes, sizeof(sizes));
+
+  segment* segments = _track_generator->getSegments();
+  int num_segments = _track_generator->getNumSegments();
+
+  for (int s=0; s < num_segments; s++) {
+    hash = hash_bytes(hash, &segments[s]._length, sizeof(segments[s]._length));
+    hash = hash_bytes(hash, &segments[s]._region_id, sizeof(int));
+  }
+
+  return hash;
+}
+
+
+/**
+ * @brief Records a fingerprint of the cross-sections of each Material in
+ *        the Geometry.
+ * @details This is used by Solver::resolve() to find the Materials whose
+ *          cross-sections have changed since the source was converged.
+ */
+void Solver::recordMaterialFingerprints() {
+
+  std::map<int, Material*> materials = _geometry->getMaterials();
+  std::map<int, Material*>::iterator iter;
+
+  _material_fingerprints.clear();
+
+  for (iter=materials.begin(); iter != materials.end(); ++iter)
+    _material_fingerprints[iter->second->getUid()] =
+         computeMaterialFingerprint(iter->second);
+}
+
+
+/**
+ * @brief Computes a fingerprint of a Material's cross-sections.
+ * @param material a pointer to the Material
+ * @return the 64-bit FNV-1a hash of the cross-sections
+ */
+uint64_t Solver::computeMaterialFingerprint(Material* material) {
+
+  int num_groups = material->getNumEnergyGroups();
+  size_t size = num_groups * sizeof(FP_PRECISION);
+
+  /* The rows of an aligned scattering matrix are padded to the vector width */
+  int row_length = num_groups;
+  if (material->isDataAligned())
+    row_length = material->getNumVectorGroups() * VEC_LENGTH;
+
+  uint64_t hash = FNV_OFFSET_BASIS;
+  hash = hash_bytes(hash, material->getSigmaT(), size);
+  hash = hash_bytes(hash, material->getSigmaA(), size);
+  hash = hash_bytes(hash, material->getSigmaF(), size);
+  hash = hash_bytes(hash, material->getNuSigmaF(), size);
+  hash = hash_bytes(hash, material->getChi(), size);
+  hash = hash_bytes(hash, material->getSigmaS(), row_length * size);
+
+  return hash;
+}
+
+
+/**
+ * @brief Zeroes the work of each thread and starts timing a transport sweep.
+ * @param num_threads the number of threads sweeping Tracks
+ */
+void Solver::startSweepReport(int num_threads) {
+
+  if (num_threads != _num_report_threads) {
+
+    if (_thread_num_segments != NULL)
+      delete [] _thread_num_segments;
+
+    if (_thread_busy_times != NULL)
+      delete [] _thread_busy_times;
+
+    _thread_num_segments = new long[num_threads];
+    _thread_busy_times = new double[num_threads];
+    _num_report_threads = num_threads;
+  }
+
+  for (int t=0; t < num_threads; t++) {
+    _thread_num_segments[t] = 0;
+    _thread_busy_times[t] = 0.;
+  }
+
+  _sweep_start_time = omp_get_wtime();
+}
+
+
+/**
+ * @brief Stops timing a transport sweep and logs its load imbalance.
+ */
+void Solver::stopSweepReport() {
+
+  _sweep_time = omp_get_wtime() - _sweep_start_time;
+
+  double tot_idle_time = 0.;
+
+  for (int t=0; t < _num_report_threads; t++)
+    tot_idle_time += getThreadIdleTime(t);
+
+  log_printf(INFO, "Transport sweep load imbalance = %1.4f with %2.2f%% "
+             "idle thread time", getSweepLoadImbalance(),
+             100. * tot_idle_time / (_sweep_time * _num_report_threads));
+}
+
+
 /**
  * @brief Deletes the Timer's timing entries for each timed code section
  *        code in the source convergence loop.
@@ -635,6 +1373,15 @@ void Solver::printTimerReport() {
   msg_string.resize(53, '.');
   log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(), time_per_integration);
 
+  /* Data TLB misses per segment, if hardware counters are available */
+  if (_num_tlb_misses >= 0 && _num_iterations > 0) {
+    double tlb_misses_per_segment =
+         double(_num_tlb_misses) / (double(_num_iterations) * num_segments);
+    msg_string = "Data TLB misses per segment per iteration";
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%1.4E", msg_string.c_str(), tlb_misses_per_segment);
+  }
+
   set_separator_character('-');
   log_printf(SEPARATOR, "-");
 
@@ -666,3 +1413,37 @@ void Solver::printTimerReport() {
   log_printf(RESULT, "%s", msg.str().c_str());
   log_printf(SEPARATOR, "-");
 }
+
+
+/**
+ * @brief Prints a report of the work of each thread in the last transport
+ *        sweep to the console.
+ * @details The Solver must record the transport sweeps with
+ *          Solver::setSweepReport(...).
+ */
+void Solver::printSweepReport() {
+
+  if (_num_report_threads == 0)
+    log_printf(ERROR, "Unable to print a sweep report since no transport "
+               "sweep has been reported");
+
+  log_printf(TITLE, "SWEEP REPORT");
+
+  log_printf(RESULT, "Wall time of the last transport sweep: %1.4E sec",
+             _sweep_time);
+  log_printf(RESULT, "Load imbalance (max / mean busy time): %1.4f",
+             getSweepLoadImbalance());
+
+  set_separator_character('-');
+  log_printf(SEPARATOR, "-");
+  log_printf(RESULT, "  thread        # segments        busy (sec)        "
+             "idle (sec)");
+  log_printf(SEPARATOR, "-");
+
+  for (int t=0; t < _num_report_threads; t++)
+    log_printf(RESULT, "%8d  %16ld  %16.4E  %16.4E", t,
+               _thread_num_segments[t], _thread_busy_times[t],
+               getThreadIdleTime(t));
+
+  log_printf(SEPARATOR, "-");
+}
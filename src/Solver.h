@@ -11,10 +11,17 @@
 #ifdef __cplusplus
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <map>
+#include <vector>
 #include "Timer.h"
 #include "Quadrature.h"
 #include "TrackGenerator.h"
 #include "pairwise_sum.h"
+#include "exponential.h"
 #include "Cmfd.h"
 #endif
 
@@ -65,6 +72,31 @@
 /** The values of 1 divided by 4pi: \f$ \frac{1}{4\pi} \f$ */
 #define ONE_OVER_FOUR_PI 0.0795774715
 
+/** The version of the binary checkpoint file format */
+#define CHECKPOINT_VERSION 1
+
+/** The number of values in each chunk streamed to or from a checkpoint */
+#define CHECKPOINT_CHUNK_SIZE 65536
+
+
+/**
+ * @enum checkpointArray
+ * @brief The arrays of floating point values stored in a checkpoint of
+ *        the Solver's state.
+ */
+enum checkpointArray {
+
+  /** The scalar flux in each FSR and energy group */
+  CHECKPOINT_SCALAR_FLUX,
+
+  /** The source from the previous iteration in each FSR and energy group */
+  CHECKPOINT_OLD_SOURCE,
+
+  /** The boundary angular fluxes for each Track, direction, polar angle
+   *  and energy group */
+  CHECKPOINT_BOUNDARY_FLUX
+};
+
 
 /**
  * @class Solver Solver.h "src/Solver.h"
@@ -189,6 +221,16 @@ protected:
    *  to comptue the exponential in the transport equation */
   bool _interpolate_exponential;
 
+  /** A boolean indicating whether or not to use a polynomial to compute
+   *  the exponential in the transport equation */
+  bool _polynomial_exponential;
+
+  /** The degree of the polynomial used to compute the exponential */
+  int _exp_poly_degree;
+
+  /** The coefficients of the polynomial used to compute the exponential */
+  FP_PRECISION _exp_poly_coefficients[MAX_EXP_POLY_DEGREE+1];
+
   /** The exponential linear interpolation table */
   FP_PRECISION* _exp_table;
 
@@ -207,9 +249,50 @@ protected:
   /** A timer to record timing data for a simulation */
   Timer* _timer;
 
+  /** Whether to count the data TLB misses during the source iterations */
+  bool _count_tlb_misses;
+
+  /** The data TLB misses of all threads during the source iterations (-1
+   *  if they were not or could not be counted) */
+  long _num_tlb_misses;
+
   /** A pointer to a Coarse Mesh Finite Difference (CMFD) acceleration object */
   Cmfd* _cmfd;
 
+  /** The file to write checkpoints to during source convergence */
+  std::string _checkpoint_file;
+
+  /** The number of source iterations between checkpoints (0 for none) */
+  int _checkpoint_interval;
+
+  /** The checkpoint file to resume source convergence from (empty to
+   *  start from a flat source) */
+  std::string _restart_file;
+
+  /** A fingerprint of the cross-sections of each Material, indexed by
+   *  Material UID, when the source was last converged */
+  std::map<int, uint64_t> _material_fingerprints;
+
+  /** Whether to record the work of each thread in each transport sweep */
+  bool _sweep_report;
+
+  /** The number of threads in the report of the last transport sweep */
+  int _num_report_threads;
+
+  /** The number of segments swept by each thread in both directions in the
+   *  last transport sweep */
+  long* _thread_num_segments;
+
+  /** The time spent by each thread sweeping Tracks in the last transport
+   *  sweep */
+  double* _thread_busy_times;
+
+  /** The start time of the last transport sweep */
+  double _sweep_start_time;
+
+  /** The wall time of the last transport sweep */
+  double _sweep_time;
+
   int round_to_int(float x);
   int round_to_int(double x);
 
@@ -292,8 +375,29 @@ protected:
    */
   virtual void transportSweep() =0;
 
+  virtual FP_PRECISION sourceIteration();
+
+  /**
+   * @brief Refreshes any data derived from the cross-sections of some
+   *        Materials, such as copies of the cross-sections on a device.
+   * @param materials the Materials whose cross-sections have changed
+   */
+  virtual void updateMaterials(std::vector<Material*>& materials) =0;
+
+  FP_PRECISION iterateSource(int max_iterations);
+  void recordMaterialFingerprints();
+  uint64_t computeMaterialFingerprint(Material* material);
+  void startSweepReport(int num_threads);
+  void stopSweepReport();
   void clearTimerSplits();
 
+  long getCheckpointArraySize(checkpointArray array);
+  virtual void getCheckpointArray(checkpointArray array, long offset,
+                                  long length, FP_PRECISION* values);
+  virtual void setCheckpointArray(checkpointArray array, long offset,
+                                  long length, FP_PRECISION* values);
+  uint64_t computeCheckpointFingerprint();
+
 
 public:
   Solver(Geometry* geom=NULL, TrackGenerator* track_generator=NULL,
@@ -306,13 +410,20 @@ public:
   quadratureType getPolarQuadratureType();
   int getNumIterations();
   double getTotalTime();
+  long getNumTLBMisses();
   FP_PRECISION getKeff();
   FP_PRECISION getSourceConvergenceThreshold();
+  int getNumReportThreads();
+  long getThreadNumSegments(int thread);
+  double getThreadBusyTime(int thread);
+  double getThreadIdleTime(int thread);
+  double getSweepLoadImbalance();
 
   bool isUsingSinglePrecision();
   bool isUsingDoublePrecision();
   bool isUsingExponentialInterpolation();
   bool isUsingExponentialIntrinsic();
+  bool isUsingExponentialPolynomial();
 
   /**
    * @brief Returns the scalar flux for a FSR and energy group.
@@ -345,8 +456,16 @@ public:
 
   void useExponentialInterpolation();
   void useExponentialIntrinsic();
+  void useExponentialPolynomial();
+  void setCheckpointFile(const char* filename, int interval);
+  void setRestartFile(const char* filename);
+  void setSweepReport(bool sweep_report);
+  void setCountTLBMisses(bool count_tlb_misses);
 
   virtual FP_PRECISION convergeSource(int max_iterations);
+  virtual FP_PRECISION resolve(int max_iterations);
+  void writeCheckpoint(const char* filename);
+  void readCheckpoint(const char* filename);
 
 /**
  * @brief Computes the volume-weighted, energy integrated fission rate in
@@ -367,6 +486,7 @@ public:
   virtual void computeFSRFissionRates(double* fission_rates, int num_FSRs) =0;
 
   void printTimerReport();
+  void printSweepReport();
 };
 
 
@@ -18,6 +18,13 @@ ThreadPrivateSolver::ThreadPrivateSolver(Geometry* geometry,
 
   _thread_flux = NULL;
   _thread_currents = NULL;
+  _num_thread_FSRs = NULL;
+  _thread_FSRs = NULL;
+  _thread_track_offsets = NULL;
+  _segment_thread_FSRs = NULL;
+  _FSR_thread_offsets = NULL;
+  _FSR_threads = NULL;
+  _FSR_thread_indices = NULL;
 }
 
 
@@ -27,14 +34,7 @@ ThreadPrivateSolver::ThreadPrivateSolver(Geometry* geometry,
  */
 ThreadPrivateSolver::~ThreadPrivateSolver() {
 
-  if (_thread_flux != NULL) {
-
-    for (int t=0; t < _num_threads; t++)
-      delete [] _thread_flux[t];
-
-    delete [] _thread_flux;
-    _thread_flux = NULL;
-  }
+  deleteThreadFSRs();
 
   if (_thread_currents != NULL) {
     delete [] _thread_currents;
@@ -44,38 +44,240 @@ ThreadPrivateSolver::~ThreadPrivateSolver() {
 }
 
 
+/**
+ * @brief Sets whether each source iteration runs in a single parallel region.
+ * @details The thread private transport sweep and reductions fork their own
+ *          teams of threads, so a persistent parallel region is not
+ *          supported.
+ * @param persistent whether to use a persistent parallel region
+ */
+void ThreadPrivateSolver::setPersistentParallelRegion(bool persistent) {
+
+  if (persistent)
+    log_printf(ERROR, "Unable to use a persistent parallel region for the "
+               "source iterations of a ThreadPrivateSolver");
+}
+
+
 /**
  * @brief Allocates memory for Track boundary angular flux and leakage and
  *        FSR scalar flux arrays.
  * @details Deletes memory for old flux arrays if they were allocated for a
- *          previous simulation.
+ *          previous simulation. Each thread's private FSR scalar flux array
+ *          only stores the FSRs crossed by the Tracks swept by the thread.
  */
 void ThreadPrivateSolver::initializeFluxArrays() {
 
   CPUSolver::initializeFluxArrays();
 
   /* Delete old flux arrays if they exist */
-  if (_thread_flux != NULL) {
-    for (int t=0; t < _num_threads; t++)
-      delete [] _thread_flux[t];
+  deleteThreadFSRs();
 
-    delete [] _thread_flux;
-  }
+  initializeThreadFSRs();
 
-  int size;
+  long size = 0;
 
   /* Allocate memory for the flux and leakage arrays */
   try{
 
     /* Allocate a thread local array of FSR scalar fluxes */
     _thread_flux = new FP_PRECISION*[_num_threads];
-    for (int t=0; t < _num_threads; t++)
-      _thread_flux[t] = new FP_PRECISION[_num_FSRs * _num_groups];
+    for (int t=0; t < _num_threads; t++) {
+      _thread_flux[t] = new FP_PRECISION[_num_thread_FSRs[t] * _num_groups];
+      size += _num_thread_FSRs[t];
+    }
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the Solver's fluxes. "
                "Backtrace:%s", e.what());
   }
+
+  /* Zero each thread's scalar fluxes with the thread which sweeps them in
+   * transportSweep(), such that their pages lie on the thread's NUMA node */
+  #pragma omp parallel for schedule(static, 1)
+  for (int tid=0; tid < _num_threads; tid++)
+    memset(_thread_flux[tid], 0,
+           _num_thread_FSRs[tid] * _num_groups * sizeof(FP_PRECISION));
+
+  log_printf(INFO, "Thread private scalar fluxes for %ld of %ld FSRs across "
+             "%d threads", size, long(_num_FSRs) * _num_threads, _num_threads);
+}
+
+
+/**
+ * @brief Assigns Tracks to threads and finds the FSRs crossed by each
+ *        thread's Tracks.
+ * @details The Tracks in each azimuthal angle halfspace are divided into
+ *          consecutive ranges with about the same number of segments for
+ *          each thread by TrackGenerator::partitionTracks(...), in the order
+ *          of TrackGenerator::sortTracks() if the Tracks have been sorted.
+ *          The index of each segment's FSR in the thread's array of FSRs is
+ *          stored for the transport sweep, and the threads which cross each
+ *          FSR are stored for the reduction of the thread private scalar
+ *          fluxes.
+ */
+void ThreadPrivateSolver::initializeThreadFSRs() {
+
+  segment* first_segment = _track_generator->getSegments();
+  int num_segments = _track_generator->getNumSegments();
+
+  /* The Tracks sorted for spatial locality if they have been sorted */
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
+
+  try{
+    _num_thread_FSRs = new int[_num_threads];
+    _thread_FSRs = new int*[_num_threads];
+    _thread_track_offsets = new int[2 * (_num_threads+1)];
+    _segment_thread_FSRs = new int[num_segments];
+    _FSR_thread_offsets = new int[_num_FSRs+1];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the thread private "
+               "FSRs. Backtrace:%s", e.what());
+  }
+
+  /* Divide the Tracks in each halfspace by their number of segments */
+  if (!_track_generator->containsTrackPartitioning() ||
+      _track_generator->getNumPartitions() != _num_threads)
+    _track_generator->partitionTracks(_num_threads);
+
+  memcpy(_thread_track_offsets, _track_generator->getPartitionOffsets(),
+         2 * (_num_threads+1) * sizeof(int));
+
+  /* Find the FSRs crossed by each thread's Tracks */
+  #pragma omp parallel for schedule(dynamic)
+  for (int tid=0; tid < _num_threads; tid++) {
+
+    std::vector<int> FSRs;
+
+    for (int i=0; i < 2; i++) {
+      for (int t=_thread_track_offsets(i,tid);
+           t < _thread_track_offsets(i,tid+1); t++) {
+
+        int track_id = (sorted_tracks != NULL) ? sorted_tracks[t] : t;
+        segment* segments = _tracks[track_id]->getSegments();
+        for (int s=0; s < _tracks[track_id]->getNumSegments(); s++)
+          FSRs.push_back(segments[s]._region_id);
+      }
+    }
+
+    std::sort(FSRs.begin(), FSRs.end());
+    FSRs.erase(std::unique(FSRs.begin(), FSRs.end()), FSRs.end());
+
+    _num_thread_FSRs[tid] = FSRs.size();
+    _thread_FSRs[tid] = new int[FSRs.size()];
+    std::copy(FSRs.begin(), FSRs.end(), _thread_FSRs[tid]);
+
+    /* Find the index of each segment's FSR in the thread's FSRs */
+    for (int i=0; i < 2; i++) {
+      for (int t=_thread_track_offsets(i,tid);
+           t < _thread_track_offsets(i,tid+1); t++) {
+
+        int track_id = (sorted_tracks != NULL) ? sorted_tracks[t] : t;
+        segment* segments = _tracks[track_id]->getSegments();
+        int* indices = &_segment_thread_FSRs[segments - first_segment];
+
+        for (int s=0; s < _tracks[track_id]->getNumSegments(); s++)
+          indices[s] = std::lower_bound(FSRs.begin(), FSRs.end(),
+                       segments[s]._region_id) - FSRs.begin();
+      }
+    }
+  }
+
+  /* Count the threads crossing each FSR */
+  for (int r=0; r <= _num_FSRs; r++)
+    _FSR_thread_offsets[r] = 0;
+
+  for (int tid=0; tid < _num_threads; tid++) {
+    for (int i=0; i < _num_thread_FSRs[tid]; i++)
+      _FSR_thread_offsets[_thread_FSRs[tid][i]+1]++;
+  }
+
+  for (int r=0; r < _num_FSRs; r++)
+    _FSR_thread_offsets[r+1] += _FSR_thread_offsets[r];
+
+  try{
+    _FSR_threads = new int[_FSR_thread_offsets[_num_FSRs]];
+    _FSR_thread_indices = new int[_FSR_thread_offsets[_num_FSRs]];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the thread private "
+               "FSRs. Backtrace:%s", e.what());
+  }
+
+  /* Store the threads for each FSR in order of increasing thread ID */
+  int* next = new int[_num_FSRs];
+  std::copy(_FSR_thread_offsets, _FSR_thread_offsets + _num_FSRs, next);
+
+  for (int tid=0; tid < _num_threads; tid++) {
+    for (int i=0; i < _num_thread_FSRs[tid]; i++) {
+      int r = _thread_FSRs[tid][i];
+      _FSR_threads[next[r]] = tid;
+      _FSR_thread_indices[next[r]] = i;
+      next[r]++;
+    }
+  }
+
+  delete [] next;
+
+  return;
+}
+
+
+/**
+ * @brief Deletes the thread private FSR scalar fluxes and the arrays which
+ *        map them to the FSRs.
+ */
+void ThreadPrivateSolver::deleteThreadFSRs() {
+
+  if (_thread_flux != NULL) {
+    for (int t=0; t < _num_threads; t++)
+      delete [] _thread_flux[t];
+
+    delete [] _thread_flux;
+    _thread_flux = NULL;
+  }
+
+  if (_thread_FSRs != NULL) {
+    for (int t=0; t < _num_threads; t++)
+      delete [] _thread_FSRs[t];
+
+    delete [] _thread_FSRs;
+    _thread_FSRs = NULL;
+  }
+
+  if (_num_thread_FSRs != NULL) {
+    delete [] _num_thread_FSRs;
+    _num_thread_FSRs = NULL;
+  }
+
+  if (_thread_track_offsets != NULL) {
+    delete [] _thread_track_offsets;
+    _thread_track_offsets = NULL;
+  }
+
+  if (_segment_thread_FSRs != NULL) {
+    delete [] _segment_thread_FSRs;
+    _segment_thread_FSRs = NULL;
+  }
+
+  if (_FSR_thread_offsets != NULL) {
+    delete [] _FSR_thread_offsets;
+    _FSR_thread_offsets = NULL;
+  }
+
+  if (_FSR_threads != NULL) {
+    delete [] _FSR_threads;
+    _FSR_threads = NULL;
+  }
+
+  if (_FSR_thread_indices != NULL) {
+    delete [] _FSR_thread_indices;
+    _FSR_thread_indices = NULL;
+  }
 }
 
 
@@ -127,7 +329,7 @@ void ThreadPrivateSolver::flattenFSRFluxes(FP_PRECISION value) {
   /* Flatten the thread private FSR scalar flux array */
   #pragma omp parallel for schedule(guided)
   for (int tid=0; tid < _num_threads; tid++) {
-    for (int r=0; r < _num_FSRs; r++) {
+    for (int r=0; r < _num_thread_FSRs[tid]; r++) {
       for (int e=0; e < _num_groups; e++)
         _thread_flux(tid,r,e) = 0.0;
     }
@@ -164,18 +366,31 @@ void ThreadPrivateSolver::zeroSurfaceCurrents() {
  *        Tracks, Track segments, polar angles and energy groups.
  * @details The method integrates the flux along each track and updates the
  *          boundary fluxes for the corresponding output Track, while updating
- *          the scalar flux in each flat source region.
+ *          the scalar flux in each flat source region. Each thread sweeps
+ *          its own range of Tracks in each azimuthal angle halfspace, and
+ *          the work of each thread is recorded if the sweep is reported.
  */
 void ThreadPrivateSolver::transportSweep() {
 
-  int tid;
-  int fsr_id;
+  int* thread_FSRs;
+  FP_PRECISION* thread_flux;
   Track* curr_track;
   int azim_index;
   int num_segments;
   segment* curr_segment;
   segment* segments;
+  meshCrossing* crossings;
+  int num_crossings;
+  int c;
   FP_PRECISION* track_flux;
+  segment* first_segment = _track_generator->getSegments();
+  bool cmfd_on = _cmfd->getMesh()->getCmfdOn();
+
+  /* The Tracks sorted for spatial locality if they have been sorted */
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
 
   log_printf(DEBUG, "Transport sweep with %d OpenMP threads", _num_threads);
 
@@ -185,57 +400,95 @@ void ThreadPrivateSolver::transportSweep() {
   if (_cmfd->getMesh()->getCmfdOn())
     zeroSurfaceCurrents();
 
+  if (_sweep_report)
+    startSweepReport(_num_threads);
+
   /* Loop over azimuthal angle halfspaces */
   for (int i=0; i < 2; i++) {
 
-    /* Compute the minimum and maximum Track IDs corresponding to this
-     * this azimuthal angular halfspace */
-    int min = i * (_tot_num_tracks / 2);
-    int max = (i + 1) * (_tot_num_tracks / 2);
-
-    /* Loop over each thread within this azimuthal angle halfspace */
-    #pragma omp parallel for private(tid, fsr_id, curr_track, azim_index, \
-      num_segments, segments, curr_segment,  track_flux) schedule(guided)
-    for (int track_id=min; track_id < max; track_id++) {
-
-      tid = omp_get_thread_num();
-
-      /* Initialize local pointers to important data structures */
-      curr_track = _tracks[track_id];
-      azim_index = curr_track->getAzimAngleIndex();
-      num_segments = curr_track->getNumSegments();
-      segments = curr_track->getSegments();
-      track_flux = &_boundary_flux(track_id,0,0,0);
-
-      /* Loop over each Track segment in forward direction */
-      for (int s=0; s < num_segments; s++) {
-        curr_segment = &segments[s];
-        fsr_id = curr_segment->_region_id;
-        scalarFluxTally(curr_segment, azim_index, track_flux,
-                        &_thread_flux(tid,fsr_id,0),true);
-      }
+    /* Loop over each thread's Tracks within this azimuthal angle halfspace */
+    #pragma omp parallel for private(thread_FSRs, thread_flux, curr_track, \
+      azim_index, num_segments, segments, curr_segment, crossings, \
+      num_crossings, c, track_flux) schedule(static, 1)
+    for (int tid=0; tid < _num_threads; tid++) {
+
+      thread_flux = _thread_flux[tid];
+      double start_time = 0.;
+
+      if (_sweep_report)
+        start_time = omp_get_wtime();
+
+      for (int t=_thread_track_offsets(i,tid);
+           t < _thread_track_offsets(i,tid+1); t++) {
+
+        int track_id = (sorted_tracks != NULL) ? sorted_tracks[t] : t;
+
+        /* Initialize local pointers to important data structures */
+        curr_track = _tracks[track_id];
+        azim_index = curr_track->getAzimAngleIndex();
+        num_segments = curr_track->getNumSegments();
+        segments = curr_track->getSegments();
+        thread_FSRs = &_segment_thread_FSRs[segments - first_segment];
+        track_flux = getTrackFlux(track_id, true);
+        crossings = curr_track->getMeshCrossings();
+        num_crossings = cmfd_on ? curr_track->getNumMeshCrossings() : 0;
+        c = 0;
+
+        /* Loop over each Track segment in forward direction */
+        for (int s=0; s < num_segments; s++) {
+          curr_segment = &segments[s];
+          scalarFluxTally(curr_segment, azim_index, track_flux,
+                          &thread_flux[thread_FSRs[s]*_num_groups]);
+
+          /* Tally the current across the Mesh surface at the end point */
+          if (c < num_crossings && crossings[c]._segment_id == s) {
+            if (crossings[c]._mesh_surface_fwd != -1)
+              accumulateSurfaceCurrent(crossings[c]._mesh_surface_fwd,
+                                       azim_index, track_flux);
+            c++;
+          }
+        }
 
-      /* Transfer boundary angular flux to outgoing track */
-      transferBoundaryFlux(track_id, azim_index, true, track_flux);
+        /* Transfer boundary angular flux to outgoing track */
+        transferBoundaryFlux(track_id, azim_index, true, track_flux);
+
+       /* Loop over each Track segment in reverse direction */
+        track_flux = getTrackFlux(track_id, false);
+        c = num_crossings - 1;
+
+        for (int s=num_segments-1; s > -1; s--) {
+          curr_segment = &segments[s];
+          scalarFluxTally(curr_segment, azim_index, track_flux,
+                          &thread_flux[thread_FSRs[s]*_num_groups]);
+
+          /* Tally the current across the Mesh surface at the start point */
+          if (c >= 0 && crossings[c]._segment_id == s) {
+            if (crossings[c]._mesh_surface_bwd != -1)
+              accumulateSurfaceCurrent(crossings[c]._mesh_surface_bwd,
+                                       azim_index, track_flux);
+            c--;
+          }
+        }
 
-     /* Loop over each Track segment in reverse direction */
-      track_flux += _polar_times_groups;
+        /* Transfer boundary angular flux to outgoing Track */
+        transferBoundaryFlux(track_id, azim_index, false, track_flux);
 
-      for (int s=num_segments-1; s > -1; s--) {
-        curr_segment = &segments[s];
-        fsr_id = curr_segment->_region_id;
-        scalarFluxTally(curr_segment, azim_index, track_flux,
-                        &_thread_flux(tid,fsr_id,0),false);
+        if (_sweep_report)
+          _thread_num_segments[tid] += 2 * num_segments;
       }
 
-      /* Transfer boundary angular flux to outgoing Track */
-      transferBoundaryFlux(track_id, azim_index, false, track_flux);
+      /* Record the time spent by this thread for the sweep report */
+      if (_sweep_report)
+        _thread_busy_times[tid] += omp_get_wtime() - start_time;
     }
   }
 
+  if (_sweep_report)
+    stopSweepReport();
+
   reduceThreadScalarFluxes();
 
-  if (_cmfd->getMesh()->getCmfdOn())
+  if (cmfd_on)
     reduceThreadSurfaceCurrents();
 
   return;
@@ -243,79 +496,27 @@ void ThreadPrivateSolver::transportSweep() {
 
 
 /**
- * @brief Computes the contribution to the FSR scalar flux from a Track segment.
- * @details This method integrates the angular flux for a Track segment across
- *          energy groups and polar angles, and tallies it into the FSR scalar
- *          flux, and updates the Track's angular flux.
- * @param curr_segment a pointer to the Track segment of interest
- * @param azim_index a pointer to the azimuthal angle index for this segment
+ * @brief Tallies the current crossing a Cmfd Mesh surface from a Track's
+ *        angular flux into the thread's private Mesh surface currents.
+ * @param surface_id the ID for the Cmfd Mesh surface crossed
+ * @param azim_index the azimuthal angle index for the Track
  * @param track_flux a pointer to the Track's angular flux
- * @param fsr_flux a pointer to the temporary FSR scalar flux buffer
- * @param fwd
  */
-void ThreadPrivateSolver::scalarFluxTally(segment* curr_segment,
-                                          int azim_index,
-                                          FP_PRECISION* track_flux,
-                                          FP_PRECISION* fsr_flux,
-                                          bool fwd){
+void ThreadPrivateSolver::accumulateSurfaceCurrent(int surface_id,
+                                                   int azim_index,
+                                                   FP_PRECISION* track_flux) {
 
   int tid = omp_get_thread_num();
-  int fsr_id = curr_segment->_region_id;
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
-
-  /* The change in angular flux along this Track segment in the FSR */
-  FP_PRECISION delta_psi;
-  FP_PRECISION exponential;
 
   /* Loop over energy groups */
-  for (int e=0; e < _num_groups; e++) {
+  for (int e = 0; e < _num_groups; e++) {
 
     /* Loop over polar angles */
-    for (int p=0; p < _num_polar; p++){
-      exponential = computeExponential(sigma_t[e], length, p);
-      delta_psi = (track_flux(p,e)-_reduced_source(fsr_id,e))*exponential;
-      fsr_flux[e] += delta_psi * _polar_weights(azim_index,p);
-      track_flux(p,e) -= delta_psi;
-    }
-  }
-
-  if (_cmfd->getMesh()->getCmfdOn()){
-    if (curr_segment->_mesh_surface_fwd != -1 && fwd){
-
-      int pe = 0;
-
-      /* Loop over energy groups */
-      for (int e = 0; e < _num_groups; e++) {
-
-        /* Loop over polar angles */
-        for (int p = 0; p < _num_polar; p++){
-
-          /* Increment current (polar and azimuthal weighted flux, group)*/
-          _thread_currents(tid,curr_segment->_mesh_surface_fwd,e) +=
-                             track_flux(p,e)*_polar_weights(azim_index, p)/2.0;
-          pe++;
-        }
-      }
-    }
-    else if (curr_segment->_mesh_surface_bwd != -1 && !fwd){
-
-      /* Set polar angle * energy group to 0 */
-      int pe = 0;
-
-      /* Loop over energy groups */
-      for (int e = 0; e < _num_groups; e++) {
-
-        /* Loop over polar angles */
-        for (int p = 0; p < _num_polar; p++){
+    for (int p = 0; p < _num_polar; p++){
 
-          /* increment current (polar and azimuthal weighted flux, group)*/
-          _thread_currents(tid,curr_segment->_mesh_surface_bwd,e) +=
-                             track_flux(p,e)*_polar_weights(azim_index, p)/2.0;
-
-          pe++;
-        }
-      }
+      /* Increment current (polar and azimuthal weighted flux, group)*/
+      _thread_currents(tid,surface_id,e) +=
+                         track_flux(p,e)*_polar_weights(azim_index, p)/2.0;
     }
   }
 
@@ -326,13 +527,24 @@ void ThreadPrivateSolver::scalarFluxTally(segment* curr_segment,
 /**
  * @brief Reduces the FSR scalar fluxes from private thread private arrays to a
  *        global array FSR scalar flux array.
+ * @details Each FSR's scalar flux only sums the thread private scalar fluxes
+ *          for the threads whose Tracks cross the FSR. The sum is taken in
+ *          order of increasing thread ID for reproducibility.
  */
 void ThreadPrivateSolver::reduceThreadScalarFluxes() {
 
-  for (int tid=0; tid < _num_threads; tid++) {
-    for (int r=0; r < _num_FSRs; r++) {
+  int tid;
+  int index;
+
+  #pragma omp parallel for private(tid, index) schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int i=_FSR_thread_offsets[r]; i < _FSR_thread_offsets[r+1]; i++) {
+
+      tid = _FSR_threads[i];
+      index = _FSR_thread_indices[i];
+
       for (int e=0; e < _num_groups; e++)
-        _scalar_flux(r,e) += _thread_flux(tid,r,e);
+        _scalar_flux(r,e) += _thread_flux(tid,index,e);
     }
   }
 
@@ -346,14 +558,16 @@ void ThreadPrivateSolver::reduceThreadScalarFluxes() {
  */
 void ThreadPrivateSolver::reduceThreadSurfaceCurrents() {
 
-  for (int tid=0; tid < _num_threads; tid++){
-    for (int r=0; r < _num_mesh_cells; r++) {
+  int num_cmfd_groups = _cmfd->getNumCmfdGroups();
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_mesh_cells; r++) {
+    for (int tid=0; tid < _num_threads; tid++){
       for (int s=0; s < 8; s++) {
-        for (int e=0; e < _cmfd->getNumCmfdGroups(); e++){
-          _surface_currents[(r*8+s)*_cmfd->getNumCmfdGroups() + e] +=
+        for (int e=0; e < num_cmfd_groups; e++){
+          _surface_currents[(r*8+s)*num_cmfd_groups + e] +=
                              _thread_currents[(tid)*_num_mesh_cells*8*
-                             _cmfd->getNumCmfdGroups() + (r*8+s)*
-                             _cmfd->getNumCmfdGroups() + e];
+                             num_cmfd_groups + (r*8+s)*num_cmfd_groups + e];
         }
       }
     }
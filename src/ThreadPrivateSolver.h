@@ -14,12 +14,19 @@
 #include <math.h>
 #include <omp.h>
 #include <stdlib.h>
+#include <vector>
+#include <algorithm>
 #include "CPUSolver.h"
 #endif
 
-/** Indexing scheme for the thread private FSR scalar flux for each thread */
+/** Indexing scheme for the thread private FSR scalar flux for each thread
+ *  by the index of the FSR in the thread's array of FSRs */
 #define _thread_flux(tid,r,e) (_thread_flux[(tid)][(r)*_num_groups+(e)])
 
+/** Indexing scheme for the first Track ID swept by each thread in each
+ *  azimuthal angle halfspace */
+#define _thread_track_offsets(h,tid) (_thread_track_offsets[(h)*(_num_threads+1)+(tid)])
+
 /** Indexing scheme for the thread private Cmfd Mesh surface currents for each 
  * thread in each FSR and energy group */
 #define _thread_currents(tid,r,e) (_thread_currents[(tid)*_num_mesh_cells*8*_cmfd->getNumCmfdGroups() + (r)*_cmfd->getNumCmfdGroups() + std::min((e) / _cmfd->getCmfdGroupWidth(), _cmfd->getNumCmfdGroups()-1)])
@@ -29,10 +36,12 @@
  * @class ThreadPrivateSolver ThreadPrivateSolver.h "openmoc/src/ThreadPrivateSolver.h"
  * @brief This is a subclass of the CPUSolver which uses thread private
  *        arrays for the FSR scalar fluxes to minimize OpenMPC atomics.
- * @details Since this class stores a separate copy of the FSR scalar
- *          fluxes for each OMP thread, the memory requirements are greater
- *          than for the CPUSolver, but the parallel performance and scaling
- *          are much better.
+ * @details Each thread sweeps a fixed set of Tracks with about the same
+ *          number of segments in each azimuthal angle halfspace, and stores
+ *          a private copy of the scalar fluxes for only the FSRs crossed by
+ *          its Tracks. The memory requirements are greater than for the
+ *          CPUSolver, but the parallel performance and scaling are much
+ *          better.
  */
 class ThreadPrivateSolver : public CPUSolver {
 
@@ -41,17 +50,39 @@ protected:
   /** An array for the FSR scalar fluxes for each thread */
   FP_PRECISION** _thread_flux;
 
+  /** The number of FSRs crossed by the Tracks swept by each thread */
+  int* _num_thread_FSRs;
+
+  /** The IDs of the FSRs crossed by the Tracks swept by each thread */
+  int** _thread_FSRs;
+
+  /** Offsets into the Track IDs for each thread in each halfspace */
+  int* _thread_track_offsets;
+
+  /** The index of each segment's FSR in its thread's array of FSRs */
+  int* _segment_thread_FSRs;
+
+  /** Offsets into the arrays of thread private scalar fluxes for each FSR */
+  int* _FSR_thread_offsets;
+
+  /** The threads with a private scalar flux for each FSR */
+  int* _FSR_threads;
+
+  /** The index of each FSR in each of its thread's arrays of FSRs */
+  int* _FSR_thread_indices;
+
   /** An array for the CMFD Mesh surface currents for each thread */
   FP_PRECISION* _thread_currents;
 
   void initializeFluxArrays();
+  void initializeThreadFSRs();
+  void deleteThreadFSRs();
   void initializeCmfd();
 
   void flattenFSRFluxes(FP_PRECISION value);
   void zeroSurfaceCurrents();
-  void scalarFluxTally(segment* curr_segment, int azim_index,
-                       FP_PRECISION* track_flux,
-                       FP_PRECISION* fsr_flux, bool fwd);
+  void accumulateSurfaceCurrent(int surface_id, int azim_index,
+                                FP_PRECISION* track_flux);
   void reduceThreadScalarFluxes();
   void reduceThreadSurfaceCurrents();
   void transportSweep();
@@ -61,6 +92,8 @@ public:
                       TrackGenerator* track_generator=NULL,
                       Cmfd* cmfd=NULL);
   virtual ~ThreadPrivateSolver();
+
+  void setPersistentParallelRegion(bool persistent);
 };
 
 
@@ -4,12 +4,17 @@
 /*
  * @brief Constructor initializes an empty Track.
  */
-Track::Track() { }
+Track::Track() {
+  _segments = NULL;
+  _num_segments = 0;
+}
 
 
 
 /**
  * @brief Destructor clears the Track segments container.
+ * @details The segments themselves are owned and deleted by the
+ *          TrackGenerator.
  */
 Track::~Track() {
   clearSegments();
@@ -65,18 +70,42 @@ void Track::setAzimAngleIndex(const int index) {
 
 
 /**
- * @brief Adds a segment pointer to this Track's list of segments.
- * @details This method assumes that segments are added in order of their
- *          starting location from the Track's start point.
- * @param segment a pointer to the segment
- */
-void Track::addSegment(segment* segment) {
+ * @brief Assigns this Track's segments within the TrackGenerator's
+ *        contiguous array of segments for all Tracks.
+ * @details This method assumes that the segments are stored in order of
+ *          their starting location from the Track's start point.
+ * @param segments a pointer to the Track's first segment
+ * @param num_segments the number of segments along this Track
+ */
+void Track::setSegments(segment* segments, int num_segments) {
+  _segments = segments;
+  _num_segments = num_segments;
+}
+
+
+/**
+ * @brief Adds a segment which crosses a Cmfd Mesh surface to this Track's
+ *        list of Mesh crossings.
+ * @details This method assumes that crossings are added in order of
+ *          increasing segment index.
+ * @param segment_id the index of the segment along the Track
+ * @param mesh_surface_fwd the Mesh surface at the segment's end point (or -1)
+ * @param mesh_surface_bwd the Mesh surface at the segment's start point
+ *        (or -1)
+ */
+void Track::addMeshCrossing(int segment_id, int mesh_surface_fwd,
+                            int mesh_surface_bwd) {
+
+  meshCrossing crossing;
+  crossing._segment_id = segment_id;
+  crossing._mesh_surface_fwd = mesh_surface_fwd;
+  crossing._mesh_surface_bwd = mesh_surface_bwd;
 
   try {
-    _segments.push_back(*segment);
+    _mesh_crossings.push_back(crossing);
   }
   catch (std::exception &e) {
-      log_printf(ERROR, "Unable to add a segment to Track. Backtrace:"
+      log_printf(ERROR, "Unable to add a Mesh crossing to Track. Backtrace:"
                  "\n%s", e.what());
   }
 }
@@ -369,10 +398,21 @@ bool Track::contains(Point* point) {
 
 
 /**
- * @brief Deletes each of this Track's segments.
+ * @brief Removes this Track's segments.
+ * @details The memory for the segments is owned by the TrackGenerator.
  */
 void Track::clearSegments() {
-  _segments.clear();
+  _segments = NULL;
+  _num_segments = 0;
+  clearMeshCrossings();
+}
+
+
+/**
+ * @brief Deletes each of this Track's Cmfd Mesh surface crossings.
+ */
+void Track::clearMeshCrossings() {
+  _mesh_crossings.clear();
 }
 
 
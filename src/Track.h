@@ -14,26 +14,42 @@
 #include "Material.h"
 #endif
 
+/** The maximum optical length of a segment if segments are split for the
+ *  exponential linear interpolation table */
+#define MAX_OPTICAL_LENGTH 10.
+
 /**
  * @struct segment
  * @brief A segment represents a line segment within a single flat source
  *        region along a track.
+ * @details The Material for a segment is found from its flat source region.
+ *          Cmfd Mesh surface crossings are stored separately by each Track
+ *          since few segments cross a Mesh surface.
  */
 struct segment {
 
   /** The length of the segment (cm) */
-  FP_PRECISION _length;
-
-  /** A pointer to the material in which this segment resides */
-  Material* _material;
+  float _length;
 
   /** The ID for flat source region in which this segment resides */
   int _region_id;
+};
 
-  /** The ID for the mesh surface crossed by the Track end point */
+
+/**
+ * @struct meshCrossing
+ * @brief A meshCrossing represents a segment along a Track whose start or
+ *        end point lies on a Cmfd Mesh surface.
+ */
+struct meshCrossing {
+
+  /** The index of the segment along the Track */
+  int _segment_id;
+
+  /** The ID for the mesh surface crossed by the segment end point */
   int _mesh_surface_fwd;
 
-  /** The ID for the mesh surface crossed by the Track start point */
+  /** The ID for the mesh surface crossed by the segment start point */
   int _mesh_surface_bwd;
 };
 
@@ -62,8 +78,16 @@ private:
   /** The azimuthal angle index into the global 2D ragged array of Tracks */
   int _azim_angle_index;
 
-  /** A dynamically sized vector of segments making up this Track */
-  std::vector<segment> _segments;
+  /** A pointer to this Track's segments in the TrackGenerator's contiguous
+   *  array of segments for all Tracks */
+  segment* _segments;
+
+  /** The number of segments making up this Track */
+  int _num_segments;
+
+  /** The segments along this Track which cross Cmfd Mesh surfaces, in
+   *  order of increasing segment index */
+  std::vector<meshCrossing> _mesh_crossings;
 
   /** The Track which reflects out of this Track along its "forward"
    * direction for reflective boundary conditions. */
@@ -131,6 +155,9 @@ public:
   void setTrackInJ(int j);
   void setTrackOutI(int i);
   void setTrackOutJ(int j);
+  void setSegments(segment* segments, int num_segments);
+  void addMeshCrossing(int segment_id, int mesh_surface_fwd,
+                       int mesh_surface_bwd);
 
   int getUid();
   Point* getEnd();
@@ -140,6 +167,8 @@ public:
   segment* getSegment(int s);
   segment* getSegments();
   int getNumSegments();
+  meshCrossing* getMeshCrossings();
+  int getNumMeshCrossings();
   Track *getTrackIn() const;
   Track *getTrackOut() const;
   int getTrackInI() const;
@@ -152,8 +181,8 @@ public:
   bool getBCOut() const;
 
   bool contains(Point* point);
-  void addSegment(segment* segment);
   void clearSegments();
+  void clearMeshCrossings();
   std::string toString();
 };
 
@@ -195,9 +224,9 @@ inline Track* Track::getTrackOut() const {
 inline segment* Track::getSegment(int segment) {
 
   /* If Track doesn't contain this segment, exits program */
-  if (segment >= (int)_segments.size())
+  if (segment >= _num_segments)
     log_printf(ERROR, "Attempted to retrieve segment s = %d but Track only"
-               "has %d segments", segment, _segments.size());
+               "has %d segments", segment, _num_segments);
 
   return &_segments[segment];
 }
@@ -205,11 +234,13 @@ inline segment* Track::getSegment(int segment) {
 
 
 /**
- * @brief Returns a vector of pointers to the Track's segments.
- * @return vector of segment pointers
+ * @brief Returns a pointer to the Track's first segment.
+ * @details The Track's segments are stored contiguously in the array of
+ *          segments for all Tracks owned by the TrackGenerator.
+ * @return a pointer to the Track's segments
  */
 inline segment* Track::getSegments() {
-  return &_segments[0];
+  return _segments;
 }
 
 
@@ -218,7 +249,30 @@ inline segment* Track::getSegments() {
  * @return the number of segments
  */
 inline int Track::getNumSegments() {
-  return _segments.size();
+  return _num_segments;
+}
+
+
+/**
+ * @brief Returns a pointer to the Track's Cmfd Mesh surface crossings.
+ * @return a pointer to the Mesh crossings (NULL if there are none)
+ */
+inline meshCrossing* Track::getMeshCrossings() {
+
+  if (_mesh_crossings.empty())
+    return NULL;
+
+  return &_mesh_crossings[0];
+}
+
+
+/**
+ * @brief Return the number of segments along this Track which cross a
+ *        Cmfd Mesh surface.
+ * @return the number of Mesh crossings
+ */
+inline int Track::getNumMeshCrossings() {
+  return _mesh_crossings.size();
 }
 
 
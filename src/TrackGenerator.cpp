@@ -13,12 +13,22 @@ TrackGenerator::TrackGenerator(Geometry* geometry, const int num_azim,
   _geometry = geometry;
   setNumAzim(num_azim);
   setTrackSpacing(spacing);
+  _segment_splitting = true;
   _tot_num_tracks = 0;
   _tot_num_segments = 0;
   _num_segments = NULL;
+  _segments = NULL;
+  _huge_pages = NO_HUGE_PAGES;
   _contains_tracks = false;
   _use_input_file = false;
   _tracks_filename = "";
+  _num_colors[0] = 0;
+  _num_colors[1] = 0;
+  _color_offsets = NULL;
+  _colored_tracks = NULL;
+  _sorted_tracks = NULL;
+  _num_partitions = 0;
+  _partition_offsets = NULL;
 }
 
 
@@ -27,10 +37,15 @@ TrackGenerator::TrackGenerator(Geometry* geometry, const int num_azim,
  */
 TrackGenerator::~TrackGenerator() {
 
+  clearTrackColoring();
+  clearTrackOrdering();
+  clearTrackPartitioning();
+
   /* Deletes Tracks arrays if Tracks have been generated */
   if (_contains_tracks) {
     delete [] _num_tracks;
     delete [] _num_segments;
+    huge_page_free(_segments);
     delete [] _num_x;
     delete [] _num_y;
     delete [] _azim_weights;
@@ -130,6 +145,21 @@ int* TrackGenerator::getNumSegmentsArray() {
 }
 
 
+/**
+ * @brief Returns the contiguous array of segments for all Tracks.
+ * @details The segments for each Track are stored consecutively in order
+ *          of increasing Track UID.
+ * @return a pointer to the array of segments
+ */
+segment* TrackGenerator::getSegments() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the array of segments since Tracks "
+               "have not yet been generated.");
+
+  return _segments;
+}
+
+
 /**
  * @brief Returns a 2D jagged array of the Tracks.
  * @details The first index into the array is the azimuthal angle and the
@@ -158,6 +188,221 @@ FP_PRECISION* TrackGenerator::getAzimWeights() {
 }
 
 
+/**
+ * @brief Returns whether segments are split to bound their optical length.
+ * @return true if segments are split, false otherwise
+ */
+bool TrackGenerator::getSegmentSplitting() {
+  return _segment_splitting;
+}
+
+
+/**
+ * @brief Returns the pages backing the array of segments.
+ * @return the huge pages requested for the segments
+ */
+hugePageType TrackGenerator::getHugePages() {
+  return _huge_pages;
+}
+
+
+/**
+ * @brief Computes the maximum optical length of any segment in any energy
+ *        group.
+ * @details The optical length is the product of the segment length and the
+ *          total cross-section for the Material in the segment's FSR. This
+ *          is used by the Solver to size the exponential linear
+ *          interpolation table.
+ * @return the maximum optical length
+ */
+FP_PRECISION TrackGenerator::getMaxOpticalLength() {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to compute the maximum optical length since "
+               "Tracks have not yet been generated.");
+
+  int num_FSRs = _geometry->getNumFSRs();
+  FP_PRECISION* max_sigma_t = new FP_PRECISION[num_FSRs];
+  FP_PRECISION max_optical_length = 0.;
+
+  /* Find the maximum total cross-section for each FSR */
+  for (int r=0; r < num_FSRs; r++) {
+
+    int fsr_id = _geometry->getFSRId(r);
+    CellBasic* cell = _geometry->findCellContainingFSR(fsr_id);
+    Material* material = _geometry->getMaterial(cell->getMaterial());
+    FP_PRECISION* sigma_t = material->getSigmaT();
+
+    max_sigma_t[r] = 0.;
+    for (int e=0; e < material->getNumEnergyGroups(); e++) {
+      if (sigma_t[e] > max_sigma_t[r])
+        max_sigma_t[r] = sigma_t[e];
+    }
+  }
+
+  /* Find the maximum optical length over all segments */
+  for (int s=0; s < _tot_num_segments; s++) {
+    FP_PRECISION optical_length =
+         _segments[s]._length * max_sigma_t[_segments[s]._region_id];
+
+    if (optical_length > max_optical_length)
+      max_optical_length = optical_length;
+  }
+
+  delete [] max_sigma_t;
+
+  return max_optical_length;
+}
+
+
+/**
+ * @brief Returns the total number of Track colors in both azimuthal angle
+ *        halfspaces.
+ * @return the number of Track colors
+ */
+int TrackGenerator::getNumColors() {
+  return _num_colors[0] + _num_colors[1];
+}
+
+
+/**
+ * @brief Returns the number of Track colors in an azimuthal angle halfspace.
+ * @details The colors for the first halfspace are numbered from 0 and are
+ *          followed by the colors for the second halfspace.
+ * @param halfspace the azimuthal angle halfspace (0 or 1)
+ * @return the number of Track colors in the halfspace
+ */
+int TrackGenerator::getNumColors(int halfspace) {
+
+  if (halfspace < 0 || halfspace > 1)
+    log_printf(ERROR, "Unable to return the number of Track colors for "
+               "azimuthal halfspace %d since there are only two", halfspace);
+
+  return _num_colors[halfspace];
+}
+
+
+/**
+ * @brief Returns the number of Tracks with a given color.
+ * @details This is the number of Tracks which may be swept concurrently
+ *          without any synchronization for this color.
+ * @param color the Track color
+ * @return the number of Tracks with this color
+ */
+int TrackGenerator::getNumTracksWithColor(int color) {
+
+  if (!containsTrackColoring())
+    log_printf(ERROR, "Unable to return the number of Tracks with color %d "
+               "since the Tracks have not yet been colored", color);
+
+  if (color < 0 || color >= getNumColors())
+    log_printf(ERROR, "Unable to return the number of Tracks with color %d "
+               "since there are only %d colors", color, getNumColors());
+
+  return _color_offsets[color+1] - _color_offsets[color];
+}
+
+
+/**
+ * @brief Returns the total number of segments for all Tracks with a given
+ *        color.
+ * @param color the Track color
+ * @return the number of segments for Tracks with this color
+ */
+int TrackGenerator::getNumSegmentsWithColor(int color) {
+
+  int num_segments = 0;
+  int num_tracks = getNumTracksWithColor(color);
+  int* tracks = &_colored_tracks[_color_offsets[color]];
+
+  for (int t=0; t < num_tracks; t++)
+    num_segments += _num_segments[tracks[t]];
+
+  return num_segments;
+}
+
+
+/**
+ * @brief Returns the offsets into the array of colored Track UIDs for each
+ *        Track color.
+ * @details The Tracks with color c are stored between indices
+ *          offsets[c] and offsets[c+1] in the array returned by
+ *          TrackGenerator::getColoredTracks().
+ * @return an array of offsets of length the number of colors plus one
+ */
+int* TrackGenerator::getColorOffsets() {
+
+  if (!containsTrackColoring())
+    log_printf(ERROR, "Unable to return the Track color offsets since the "
+               "Tracks have not yet been colored");
+
+  return _color_offsets;
+}
+
+
+/**
+ * @brief Returns an array of Track UIDs sorted by azimuthal angle halfspace
+ *        and Track color.
+ * @return an array of Track UIDs
+ */
+int* TrackGenerator::getColoredTracks() {
+
+  if (!containsTrackColoring())
+    log_printf(ERROR, "Unable to return the colored Tracks since the "
+               "Tracks have not yet been colored");
+
+  return _colored_tracks;
+}
+
+
+/**
+ * @brief Returns an array of Track UIDs sorted within each azimuthal angle
+ *        halfspace such that consecutive Tracks are close to each other.
+ * @details The Tracks in the first halfspace are stored in the first half
+ *          of the array and those in the second halfspace in the second half.
+ * @return an array of Track UIDs
+ */
+int* TrackGenerator::getSortedTracks() {
+
+  if (!containsTrackOrdering())
+    log_printf(ERROR, "Unable to return the sorted Tracks since the "
+               "Tracks have not yet been sorted");
+
+  return _sorted_tracks;
+}
+
+
+/**
+ * @brief Returns the number of partitions of the Tracks in each azimuthal
+ *        angle halfspace.
+ * @return the number of partitions
+ */
+int TrackGenerator::getNumPartitions() {
+  return _num_partitions;
+}
+
+
+/**
+ * @brief Returns the offsets into the Tracks in sweep order for each
+ *        partition in each azimuthal angle halfspace.
+ * @details The Tracks in partition p of halfspace h are stored between
+ *          indices offsets[h*(P+1)+p] and offsets[h*(P+1)+p+1] for P
+ *          partitions, in the order of TrackGenerator::getSortedTracks()
+ *          if the Tracks have been sorted and in order of Track UID
+ *          otherwise.
+ * @return an array of offsets of length twice the number of partitions
+ *         plus one
+ */
+int* TrackGenerator::getPartitionOffsets() {
+
+  if (!containsTrackPartitioning())
+    log_printf(ERROR, "Unable to return the Track partition offsets since "
+               "the Tracks have not yet been partitioned");
+
+  return _partition_offsets;
+}
+
+
 /**
  * @brief Returns whether or not the TrackGenerator contains Track that are
  *        for its current number of azimuthal angles, track spacing and
@@ -169,6 +414,36 @@ bool TrackGenerator::containsTracks() {
 }
 
 
+/**
+ * @brief Returns whether or not the Tracks have been colored for
+ *        conflict-free transport sweeps.
+ * @return true if the Tracks have been colored; false otherwise
+ */
+bool TrackGenerator::containsTrackColoring() {
+  return _colored_tracks != NULL;
+}
+
+
+/**
+ * @brief Returns whether or not the Tracks have been sorted for spatially
+ *        coherent transport sweeps.
+ * @return true if the Tracks have been sorted; false otherwise
+ */
+bool TrackGenerator::containsTrackOrdering() {
+  return _sorted_tracks != NULL;
+}
+
+
+/**
+ * @brief Returns whether or not the Tracks have been partitioned for
+ *        load balanced transport sweeps.
+ * @return true if the Tracks have been partitioned; false otherwise
+ */
+bool TrackGenerator::containsTrackPartitioning() {
+  return _partition_offsets != NULL;
+}
+
+
 /**
  * @brief Fills an array with the x,y coordinates for each Track.
  * @details This class method is intended to be called by the OpenMOC
@@ -254,7 +529,7 @@ void TrackGenerator::retrieveSegmentCoords(double* coords, int num_segments) {
       for (int s=0; s < _tracks[i][j].getNumSegments(); s++) {
         curr_segment = &segments[s];
 
-        coords[counter] = curr_segment->_region_id;
+        coords[counter] = _geometry->getFSRId(curr_segment->_region_id);
 
         coords[counter+1] = x0;
         coords[counter+2] = y0;
@@ -318,6 +593,53 @@ void TrackGenerator::setTrackSpacing(double spacing) {
 }
 
 
+/**
+ * @brief Sets whether to split segments to bound their optical length.
+ * @details By default, each segment is split into pieces whose optical
+ *          length does not exceed the range of the exponential linear
+ *          interpolation table. Splitting is unnecessary if the Solver
+ *          evaluates exponentials with a polynomial or the exp intrinsic,
+ *          and may be turned off to reduce the number of segments:
+ *
+ * @code
+ *          track_generator.setSegmentSplitting(False)
+ * @endcode
+ *
+ * @param splitting whether to split segments (true) or not (false)
+ */
+void TrackGenerator::setSegmentSplitting(bool splitting) {
+  _segment_splitting = splitting;
+  _tot_num_tracks = 0;
+  _tot_num_segments = 0;
+  _contains_tracks = false;
+  _use_input_file = false;
+  _tracks_filename = "";
+}
+
+
+/**
+ * @brief Sets the pages backing the contiguous array of segments.
+ * @details The transport sweep streams through the segments of Tracks
+ *          spread across the whole array, which for large geometries
+ *          misses the TLB for most Tracks if the array is backed by normal
+ *          pages. Huge pages cover the array with far fewer TLB entries.
+ *          Reserved 2 MB or 1 GB huge pages fall back to transparent huge
+ *          pages, and then to normal pages, if none are available. This must
+ *          be set before the Tracks are generated, for example from Python
+ *          as follows:
+ *
+ * @code
+ *          track_generator.setHugePages(openmoc.TRANSPARENT_HUGE_PAGES)
+ *          track_generator.generateTracks()
+ * @endcode
+ *
+ * @param huge_pages the pages to back the segments with
+ */
+void TrackGenerator::setHugePages(hugePageType huge_pages) {
+  _huge_pages = huge_pages;
+}
+
+
 /**
  * @brief Set a pointer to the Geometry to use for track generation.
  * @param geometry a pointer to the Geometry
@@ -348,6 +670,7 @@ void TrackGenerator::generateTracks() {
   if (_contains_tracks) {
     delete [] _num_tracks;
     delete [] _num_segments;
+    huge_page_free(_segments);
     delete [] _num_x;
     delete [] _num_y;
     delete [] _azim_weights;
@@ -358,6 +681,9 @@ void TrackGenerator::generateTracks() {
     delete [] _tracks;
   }
 
+  clearTrackColoring();
+  clearTrackOrdering();
+  clearTrackPartitioning();
   initializeTrackFileDirectory();
 
   /* If not Tracks input file exists, generate Tracks */
@@ -431,14 +757,20 @@ void TrackGenerator::initializeTrackFileDirectory() {
     test_filename << directory.str() << "/tracks_"
                   <<  _num_azim*2.0 << "_angles_"
                   << _spacing << "_cm_spacing_cmfd_"
-                  << _geometry->getMesh()->getMeshLevel() << ".data";
+                  << _geometry->getMesh()->getMeshLevel();
     }
   else{
     test_filename << directory.str() << "/tracks_"
                   <<  _num_azim*2.0 << "_angles_"
-                  << _spacing << "_cm_spacing.data";
+                  << _spacing << "_cm_spacing";
   }
 
+  /* Segments which are not split are stored in a separate Track file */
+  if (!_segment_splitting)
+    test_filename << "_no_splitting";
+
+  test_filename << ".data";
+
   _tracks_filename = test_filename.str();
 
   /* Check to see if a Track file exists for this geometry, number of azimuthal
@@ -953,40 +1285,51 @@ void TrackGenerator::initializeBoundaryConditions() {
 
 /**
  * @brief Generate segments for each Track across the Geometry.
+ * @details The ray tracing is performed in two passes. The first pass counts
+ *          the segments along each Track, and the second pass fills in the
+ *          segments in a contiguous array for all Tracks.
  */
 void TrackGenerator::segmentize() {
 
   log_printf(NORMAL, "Ray tracing for track segmentation...");
 
   Track* track;
+  FP_PRECISION max_optical_length = MAX_OPTICAL_LENGTH;
 
   if (_num_segments != NULL)
     delete [] _num_segments;
 
+  /* Segments are not split if their optical length is unbounded */
+  if (!_segment_splitting)
+    max_optical_length = std::numeric_limits<FP_PRECISION>::infinity();
+
   /* This section loops over all Track and segmentizes each one if the
    * Tracks were not read in from an input file */
   if (!_use_input_file) {
 
-    /* Loop over all Tracks */
-    #pragma omp parallel for private(track)
+    _num_segments = new int[_tot_num_tracks];
+
+    /* Loop over all Tracks and count their segments */
+    #pragma omp parallel for private(track) schedule(guided)
     for (int i=0; i < _num_azim; i++) {
       for (int j=0; j < _num_tracks[i]; j++){
         track = &_tracks[i][j];
-        log_printf(DEBUG, "Segmenting Track %d/%d with i = %d, j = %d",
-        track->getUid(), _tot_num_tracks, i, j);
-        _geometry->segmentize(track);
+        _num_segments[track->getUid()] =
+             _geometry->segmentize(track, NULL, max_optical_length);
       }
     }
 
-    /* Compute the total number of segments in the simulation */
-    _num_segments = new int[_tot_num_tracks];
-    _tot_num_segments = 0;
+    allocateSegments();
 
+    /* Loop over all Tracks and fill in their segments */
+    #pragma omp parallel for private(track) schedule(guided)
     for (int i=0; i < _num_azim; i++) {
-      for (int j=0; j < _num_tracks[i]; j++) {
+      for (int j=0; j < _num_tracks[i]; j++){
         track = &_tracks[i][j];
-        _num_segments[track->getUid()] = track->getNumSegments();
-        _tot_num_segments += _num_segments[track->getUid()];
+        log_printf(DEBUG, "Segmenting Track %d/%d with i = %d, j = %d",
+        track->getUid(), _tot_num_tracks, i, j);
+        _geometry->segmentize(track, track->getSegments(),
+                              max_optical_length);
       }
     }
   }
@@ -997,6 +1340,53 @@ void TrackGenerator::segmentize() {
 }
 
 
+/**
+ * @brief Allocates a contiguous array for the segments of all Tracks and
+ *        assigns each Track its portion of the array.
+ * @details The number of segments for each Track must have been computed
+ *          beforehand. The segments are stored in order of increasing Track
+ *          UID such that the Solver streams linearly through memory during
+ *          each transport sweep.
+ */
+void TrackGenerator::allocateSegments() {
+
+  Track* track;
+
+  /* Compute the total number of segments in the simulation */
+  _tot_num_segments = 0;
+
+  for (int uid=0; uid < _tot_num_tracks; uid++)
+    _tot_num_segments += _num_segments[uid];
+
+  try {
+    _segments = (segment*)huge_page_malloc(_tot_num_segments * sizeof(segment),
+                                           _huge_pages);
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for %d Track segments. "
+               "Backtrace:%s", _tot_num_segments, e.what());
+  }
+
+  /* Assign each Track its segments in order of increasing Track UID */
+  int offset = 0;
+
+  for (int i=0; i < _num_azim; i++) {
+    for (int j=0; j < _num_tracks[i]; j++) {
+      track = &_tracks[i][j];
+      track->setSegments(&_segments[offset], _num_segments[track->getUid()]);
+      offset += _num_segments[track->getUid()];
+    }
+  }
+
+  log_printf(INFO, "Allocated %d segments (%1.2f MB) for %d Tracks",
+             _tot_num_segments,
+             double(_tot_num_segments) * sizeof(segment) / 1.E6,
+             _tot_num_tracks);
+
+  return;
+}
+
+
 /**
  * @brief Writes all Track and segment data to a "*.tracks" binary file.
  * @details Storing Tracks in a binary file saves time by eliminating ray
@@ -1040,14 +1430,17 @@ void TrackGenerator::dumpTracksToFile() {
   double phi;
   int azim_angle_index;
   int num_segments;
-  std::vector<segment*> _segments;
 
   segment* curr_segment;
+  meshCrossing* crossings;
+  int num_crossings;
+  int crossing;
   double length;
   int material_id;
   int region_id;
   int mesh_surface_fwd;
   int mesh_surface_bwd;
+  int* FSRs_to_materials = _geometry->getFSRtoMaterialMap();
 
   /* Loop over all Tracks */
   for (int i=0; i < _num_azim; i++) {
@@ -1072,14 +1465,24 @@ void TrackGenerator::dumpTracksToFile() {
       fwrite(&azim_angle_index, sizeof(int), 1, out);
       fwrite(&num_segments, sizeof(int), 1, out);
 
+      crossings = curr_track->getMeshCrossings();
+      num_crossings = curr_track->getNumMeshCrossings();
+      crossing = 0;
+
       /* Loop over all segments for this Track */
       for (int s=0; s < num_segments; s++) {
 
         /* Get data for this segment */
         curr_segment = curr_track->getSegment(s);
         length = curr_segment->_length;
-        material_id = curr_segment->_material->getId();
-        region_id = curr_segment->_region_id;
+
+        /* The Track file stores FSR IDs rather than the internal FSR IDs
+         * such that it is independent of any renumbering of the FSRs */
+        region_id = _geometry->getFSRId(curr_segment->_region_id);
+
+        /* Segments no longer store a Material, but the Material UID for
+         * the FSR is kept in the Track file for a consistent format */
+        material_id = FSRs_to_materials[region_id];
 
         /* Write data for this segment to the Track file */
         fwrite(&length, sizeof(double), 1, out);
@@ -1088,8 +1491,16 @@ void TrackGenerator::dumpTracksToFile() {
 
         /* Write CMFD-related data for the Track if needed */
         if (_geometry->getMesh()->getCmfdOn()){
-          mesh_surface_fwd = curr_segment->_mesh_surface_fwd;
-          mesh_surface_bwd = curr_segment->_mesh_surface_bwd;
+          mesh_surface_fwd = -1;
+          mesh_surface_bwd = -1;
+
+          if (crossing < num_crossings &&
+              crossings[crossing]._segment_id == s) {
+            mesh_surface_fwd = crossings[crossing]._mesh_surface_fwd;
+            mesh_surface_bwd = crossings[crossing]._mesh_surface_bwd;
+            crossing++;
+          }
+
           fwrite(&mesh_surface_fwd, sizeof(int), 1, out);
           fwrite(&mesh_surface_bwd, sizeof(int), 1, out);
         }
@@ -1121,6 +1532,7 @@ bool TrackGenerator::readTracksFromFile() {
   if (_contains_tracks) {
     delete [] _num_tracks;
     delete [] _num_segments;
+    huge_page_free(_segments);
     delete [] _num_x;
     delete [] _num_y;
     delete [] _azim_weights;
@@ -1187,17 +1599,28 @@ bool TrackGenerator::readTracksFromFile() {
   int mesh_surface_fwd;
   int mesh_surface_bwd;
 
+  segment* segments;
+  segment* curr_segment;
+
+  /* The number of bytes for each segment in the Track file */
+  long segment_size = sizeof(double) + 2 * sizeof(int);
+  if (_geometry->getMesh()->getCmfdOn())
+    segment_size += 2 * sizeof(int);
+
   /* Calculate the total number of Tracks */
+  _tot_num_tracks = 0;
   for (int i=0; i < _num_azim; i++)
     _tot_num_tracks += _num_tracks[i];
 
   /* Allocate memory for the number of segments per Track array */
   _num_segments = new int[_tot_num_tracks];
 
+  /* The position of the first Track in the Track file */
+  long tracks_position = ftell(in);
+
   int uid = 0;
-  _tot_num_segments = 0;
 
-  /* Loop over Tracks */
+  /* Loop over Tracks and import all Track data but skip over the segments */
   for (int i=0; i < _num_azim; i++) {
 
     _tracks[i] = new Track[_num_tracks[i]];
@@ -1213,8 +1636,7 @@ bool TrackGenerator::readTracksFromFile() {
       ret = fread(&azim_angle_index, sizeof(int), 1, in);
       ret = fread(&num_segments, sizeof(int), 1, in);
 
-      _tot_num_segments += num_segments;
-      _num_segments[uid] += num_segments;
+      _num_segments[uid] = num_segments;
 
       /* Initialize a Track with this data */
       curr_track = &_tracks[i][j];
@@ -1222,33 +1644,54 @@ bool TrackGenerator::readTracksFromFile() {
       curr_track->setUid(uid);
       curr_track->setAzimAngleIndex(azim_angle_index);
 
+      fseek(in, num_segments * segment_size, SEEK_CUR);
+
+      uid++;
+    }
+  }
+
+  /* Allocate the contiguous array of segments for all Tracks */
+  allocateSegments();
+
+  /* Rewind to the first Track and import the segments for each Track */
+  fseek(in, tracks_position, SEEK_SET);
+
+  for (int i=0; i < _num_azim; i++) {
+    for (int j=0; j < _num_tracks[i]; j++) {
+
+      curr_track = &_tracks[i][j];
+      num_segments = curr_track->getNumSegments();
+      segments = curr_track->getSegments();
+      curr_track->clearMeshCrossings();
+
+      /* Skip over the data for this Track */
+      fseek(in, 5 * sizeof(double) + 2 * sizeof(int), SEEK_CUR);
+
       /* Loop over all segments in this Track */
       for (int s=0; s < num_segments; s++) {
 
         /* Import data for this segment from Track file */
         ret = fread(&length, sizeof(double), 1, in);
         ret = fread(&material_id, sizeof(int), 1, in);
+
+        /* The Material is found from the FSR by the Solver */
         ret = fread(&region_id, sizeof(int), 1, in);
 
         /* Initialize segment with the data */
-        segment* curr_segment = new segment;
+        curr_segment = &segments[s];
         curr_segment->_length = length;
-        curr_segment->_material = _geometry->getMaterial(material_id);
-        curr_segment->_region_id = region_id;
+        curr_segment->_region_id = _geometry->getInternalFSRId(region_id);
 
         /* Import CMFD-related data if needed */
         if (_geometry->getMesh()->getCmfdOn()){
           ret = fread(&mesh_surface_fwd, sizeof(int), 1, in);
           ret = fread(&mesh_surface_bwd, sizeof(int), 1, in);
-          curr_segment->_mesh_surface_fwd = mesh_surface_fwd;
-          curr_segment->_mesh_surface_bwd = mesh_surface_bwd;
-        }
 
-        /* Add this segment to the Track */
-        curr_track->addSegment(curr_segment);
+          if (mesh_surface_fwd != -1 || mesh_surface_bwd != -1)
+            curr_track->addMeshCrossing(s, mesh_surface_fwd,
+                                        mesh_surface_bwd);
+        }
       }
-
-      uid++;
     }
   }
 
@@ -1261,3 +1704,598 @@ bool TrackGenerator::readTracksFromFile() {
 
   return true;
 }
+
+
+/**
+ * @brief Deletes the Track coloring if one has been computed.
+ */
+void TrackGenerator::clearTrackColoring() {
+
+  if (_color_offsets != NULL)
+    delete [] _color_offsets;
+
+  if (_colored_tracks != NULL)
+    delete [] _colored_tracks;
+
+  _color_offsets = NULL;
+  _colored_tracks = NULL;
+  _num_colors[0] = 0;
+  _num_colors[1] = 0;
+}
+
+
+/**
+ * @brief Deletes the Track ordering if one has been computed.
+ */
+void TrackGenerator::clearTrackOrdering() {
+
+  if (_sorted_tracks != NULL)
+    delete [] _sorted_tracks;
+
+  _sorted_tracks = NULL;
+}
+
+
+/**
+ * @brief Deletes the Track partitioning if one has been computed.
+ */
+void TrackGenerator::clearTrackPartitioning() {
+
+  if (_partition_offsets != NULL)
+    delete [] _partition_offsets;
+
+  _partition_offsets = NULL;
+  _num_partitions = 0;
+}
+
+
+/**
+ * @brief Colors the Tracks such that Tracks with the same color do not
+ *        cross any of the same FSRs.
+ * @details Each azimuthal angle halfspace is colored separately with a
+ *          greedy first-fit algorithm which visits Tracks in order of
+ *          decreasing number of segments. Two Tracks conflict if any of
+ *          their segments reside in the same FSR, or if Cmfd is in use, if
+ *          they cross the same Cmfd Mesh surface. All Tracks with the same
+ *          color may then be swept concurrently by the CPUSolver using plain
+ *          stores for the FSR scalar fluxes and Mesh surface currents. This
+ *          method is called by the CPUSolver for the COLORED_SWEEP sweep
+ *          type, but may also be called from Python to inspect the coloring:
+ *
+ * @code
+ *          track_generator.colorTracks()
+ *          num_colors = track_generator.getNumColors()
+ * @endcode
+ */
+void TrackGenerator::colorTracks() {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to color Tracks since Tracks have not yet "
+               "been generated");
+
+  log_printf(NORMAL, "Coloring Tracks for conflict-free sweeps...");
+
+  clearTrackColoring();
+
+  bool cmfd_on = _geometry->getMesh()->getCmfdOn();
+  int num_FSRs = _geometry->getNumFSRs();
+  int num_resources = num_FSRs;
+
+  if (cmfd_on)
+    num_resources += _geometry->getMesh()->getNumCells() * 8;
+
+  /* Build an array of pointers to the Tracks indexed by Track UID */
+  Track** tracks = new Track*[_tot_num_tracks];
+
+  for (int i=0; i < _num_azim; i++) {
+    for (int j=0; j < _num_tracks[i]; j++)
+      tracks[_tracks[i][j].getUid()] = &_tracks[i][j];
+  }
+
+  /* The colors of the Tracks which have already been colored which use each
+   * FSR (and Cmfd Mesh surface) */
+  std::vector< std::vector<int> > resource_colors(num_resources);
+
+  /* The last Track to forbid each color */
+  std::vector<int> forbidden;
+
+  int* track_colors = new int[_tot_num_tracks];
+  std::vector< std::pair<int, int> > order;
+  std::vector<int> resources;
+  int color;
+
+  for (int h=0; h < 2; h++) {
+
+    int min_track = h * (_tot_num_tracks / 2);
+    int max_track = (h + 1) * (_tot_num_tracks / 2);
+    int num_colors = 0;
+
+    /* Visit the Tracks with the most segments first */
+    order.clear();
+    for (int t=min_track; t < max_track; t++)
+      order.push_back(std::make_pair(-_num_segments[t], t));
+
+    std::sort(order.begin(), order.end());
+
+    for (int r=0; r < num_resources; r++)
+      resource_colors[r].clear();
+
+    forbidden.assign(forbidden.size(), -1);
+
+    for (int t=0; t < (int)order.size(); t++) {
+
+      int uid = order[t].second;
+      findTrackResources(tracks[uid], cmfd_on, resources);
+
+      /* Forbid the colors of all Tracks which share an FSR or surface */
+      for (int r=0; r < (int)resources.size(); r++) {
+        std::vector<int>& colors = resource_colors[resources[r]];
+        for (int c=0; c < (int)colors.size(); c++)
+          forbidden[colors[c]] = uid;
+      }
+
+      /* Assign the smallest color which has not been forbidden */
+      for (color=0; color < num_colors; color++) {
+        if (forbidden[color] != uid)
+          break;
+      }
+
+      if (color == num_colors) {
+        num_colors++;
+        forbidden.push_back(-1);
+      }
+
+      track_colors[uid] = color;
+
+      /* Register this Track's color with each of its FSRs and surfaces */
+      for (int r=0; r < (int)resources.size(); r++) {
+        std::vector<int>& colors = resource_colors[resources[r]];
+        if (colors.empty() || colors.back() != color)
+          colors.push_back(color);
+      }
+    }
+
+    _num_colors[h] = num_colors;
+  }
+
+  /* Sort the Track UIDs by halfspace and color with a counting sort */
+  int tot_num_colors = getNumColors();
+  _color_offsets = new int[tot_num_colors+1];
+  _colored_tracks = new int[_tot_num_tracks];
+
+  for (int c=0; c <= tot_num_colors; c++)
+    _color_offsets[c] = 0;
+
+  for (int uid=0; uid < _tot_num_tracks; uid++) {
+    if (uid >= _tot_num_tracks / 2)
+      track_colors[uid] += _num_colors[0];
+    _color_offsets[track_colors[uid]+1]++;
+  }
+
+  for (int c=0; c < tot_num_colors; c++)
+    _color_offsets[c+1] += _color_offsets[c];
+
+  int* counts = new int[tot_num_colors];
+  for (int c=0; c < tot_num_colors; c++)
+    counts[c] = _color_offsets[c];
+
+  for (int uid=0; uid < _tot_num_tracks; uid++)
+    _colored_tracks[counts[track_colors[uid]]++] = uid;
+
+  delete [] counts;
+  delete [] track_colors;
+  delete [] tracks;
+
+  /* Report the number of colors and the parallelism of the colors */
+  for (int h=0; h < 2; h++) {
+
+    int first_color = h * _num_colors[0];
+    int min_tracks = _tot_num_tracks;
+    int max_tracks = 0;
+
+    for (int c=first_color; c < first_color + _num_colors[h]; c++) {
+      min_tracks = std::min(min_tracks, getNumTracksWithColor(c));
+      max_tracks = std::max(max_tracks, getNumTracksWithColor(c));
+    }
+
+    log_printf(NORMAL, "Azimuthal halfspace %d: %d colors with %d - %d "
+               "(avg. %1.1f) Tracks per color", h, _num_colors[h], min_tracks,
+               max_tracks, double(_tot_num_tracks / 2) / _num_colors[h]);
+  }
+
+  for (int c=0; c < tot_num_colors; c++)
+    log_printf(DEBUG, "Track color %d: %d Tracks, %d segments", c,
+               getNumTracksWithColor(c), getNumSegmentsWithColor(c));
+}
+
+
+/**
+ * @brief Finds the FSRs and Cmfd Mesh surfaces used by a Track.
+ * @details Each FSR is identified by its ID, and each Mesh surface by its ID
+ *          offset by the number of FSRs. Consecutive segments in the same
+ *          FSR are only listed once.
+ * @param track a pointer to the Track of interest
+ * @param cmfd_on whether to include the Cmfd Mesh surfaces
+ * @param resources a vector to store the FSR and Mesh surface IDs
+ */
+void TrackGenerator::findTrackResources(Track* track, bool cmfd_on,
+                                        std::vector<int>& resources) {
+
+  int num_FSRs = _geometry->getNumFSRs();
+  int num_segments = track->getNumSegments();
+  segment* segments = track->getSegments();
+
+  resources.clear();
+
+  for (int s=0; s < num_segments; s++) {
+    if (resources.empty() || resources.back() != segments[s]._region_id)
+      resources.push_back(segments[s]._region_id);
+  }
+
+  if (!cmfd_on)
+    return;
+
+  int num_crossings = track->getNumMeshCrossings();
+  meshCrossing* crossings = track->getMeshCrossings();
+
+  for (int c=0; c < num_crossings; c++) {
+    if (crossings[c]._mesh_surface_fwd != -1)
+      resources.push_back(num_FSRs + crossings[c]._mesh_surface_fwd);
+    if (crossings[c]._mesh_surface_bwd != -1)
+      resources.push_back(num_FSRs + crossings[c]._mesh_surface_bwd);
+  }
+}
+
+
+/**
+ * @brief Computes the index of a point along a Hilbert curve.
+ * @details The Hilbert curve fills a square grid of \f$ 2^{order} \f$
+ *          cells on each side such that cells with nearby indices are
+ *          close to each other.
+ * @param x the x index of the grid cell
+ * @param y the y index of the grid cell
+ * @param order the number of bits for each index
+ * @return the index along the Hilbert curve
+ */
+long TrackGenerator::hilbertCurveIndex(int x, int y, int order) {
+
+  long index = 0;
+
+  for (int s = (1 << order) / 2; s > 0; s /= 2) {
+
+    int rx = (x & s) > 0;
+    int ry = (y & s) > 0;
+    index += (long)s * s * ((3 * rx) ^ ry);
+
+    /* Rotate the quadrant such that the curve is continuous */
+    if (ry == 0) {
+      if (rx == 1) {
+        x = s - 1 - x;
+        y = s - 1 - y;
+      }
+
+      std::swap(x, y);
+    }
+  }
+
+  return index;
+}
+
+
+/**
+ * @brief Sorts the Tracks in each azimuthal angle halfspace such that
+ *        consecutive Tracks are close to each other.
+ * @details The Tracks are sorted by the index of their midpoints along a
+ *          Hilbert curve through the Geometry. The grid of the Hilbert
+ *          curve is coarse enough for each cell to hold about
+ *          TRACK_BUNDLE_SIZE Tracks, which keep their order by azimuthal
+ *          angle such that adjacent parallel Tracks remain consecutive in
+ *          each bundle. The Solvers sweep the Tracks
+ *          in this order, such that each thread sweeps a bundle of nearby
+ *          Tracks which reuse the scalar fluxes and sources of the same FSRs
+ *          from cache, while the Tracks themselves are not moved in memory.
+ *          The Tracks are not sorted across halfspaces, since the Tracks in
+ *          each halfspace only transfer their outgoing fluxes to Tracks in
+ *          the other halfspace. This method may be called from Python
+ *          before the source is converged:
+ *
+ * @code
+ *          track_generator.sortTracks()
+ * @endcode
+ */
+void TrackGenerator::sortTracks() {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to sort Tracks since Tracks have not yet "
+               "been generated");
+
+  log_printf(NORMAL, "Sorting Tracks for spatially coherent sweeps...");
+
+  clearTrackOrdering();
+  clearTrackPartitioning();
+
+  /* Find the midpoint of each Track indexed by Track UID */
+  double* x = new double[_tot_num_tracks];
+  double* y = new double[_tot_num_tracks];
+  double x_min = std::numeric_limits<double>::max();
+  double y_min = std::numeric_limits<double>::max();
+  double x_max = -std::numeric_limits<double>::max();
+  double y_max = -std::numeric_limits<double>::max();
+
+  for (int i=0; i < _num_azim; i++) {
+    for (int j=0; j < _num_tracks[i]; j++) {
+
+      Track* track = &_tracks[i][j];
+      int uid = track->getUid();
+
+      x[uid] = (track->getStart()->getX() + track->getEnd()->getX()) / 2.;
+      y[uid] = (track->getStart()->getY() + track->getEnd()->getY()) / 2.;
+
+      x_min = std::min(x_min, x[uid]);
+      y_min = std::min(y_min, y[uid]);
+      x_max = std::max(x_max, x[uid]);
+      y_max = std::max(y_max, y[uid]);
+    }
+  }
+
+  /* Find the order of the Hilbert curve with about TRACK_BUNDLE_SIZE
+   * Tracks in each halfspace with their midpoints in each grid cell */
+  int order = 0;
+
+  while (order < MAX_HILBERT_CURVE_ORDER &&
+         (1L << (2 * order)) * TRACK_BUNDLE_SIZE < _tot_num_tracks / 2)
+    order++;
+
+  /* Map the midpoints onto the grid of the Hilbert curve */
+  int num_cells = 1 << order;
+  double cell_width = std::max(x_max - x_min, y_max - y_min) / num_cells;
+
+  if (cell_width <= 0.)
+    cell_width = 1.;
+
+  _sorted_tracks = new int[_tot_num_tracks];
+  std::vector< std::pair<long, int> > sorted;
+
+  for (int h=0; h < 2; h++) {
+
+    int min_track = h * (_tot_num_tracks / 2);
+    int max_track = (h + 1) * (_tot_num_tracks / 2);
+
+    sorted.clear();
+
+    for (int uid=min_track; uid < max_track; uid++) {
+      int x_cell = std::min(int((x[uid] - x_min) / cell_width), num_cells-1);
+      int y_cell = std::min(int((y[uid] - y_min) / cell_width), num_cells-1);
+      long index = hilbertCurveIndex(x_cell, y_cell, order);
+      sorted.push_back(std::make_pair(index, uid));
+    }
+
+    /* Sort by Hilbert curve index and then by Track UID */
+    std::sort(sorted.begin(), sorted.end());
+
+    for (int t=0; t < (int)sorted.size(); t++)
+      _sorted_tracks[min_track + t] = sorted[t].second;
+  }
+
+  /* Any Track left over by an odd number of Tracks keeps its position */
+  for (int uid=2 * (_tot_num_tracks / 2); uid < _tot_num_tracks; uid++)
+    _sorted_tracks[uid] = uid;
+
+  delete [] x;
+  delete [] y;
+
+  log_printf(INFO, "Sorted Tracks along a Hilbert curve with %d x %d cells",
+             num_cells, num_cells);
+}
+
+
+/**
+ * @brief Divides the Tracks in each azimuthal angle halfspace into
+ *        consecutive ranges with about the same cost to sweep.
+ * @details The cost of a Track is its number of segments, since each
+ *          segment is swept for all of the same energy groups and polar
+ *          angles. The Tracks are visited in the order of
+ *          TrackGenerator::sortTracks() if they have been sorted, and a
+ *          range ends once the cumulative number of segments reaches its
+ *          share of the halfspace's segments. The CPUSolver sweeps each
+ *          range on one thread for the PARTITIONED_SWEEP sweep type, and
+ *          the ThreadPrivateSolver for its thread private scalar fluxes.
+ *          The partitions are computed by the Solvers as needed, but may be
+ *          computed from Python after the Tracks are sorted as follows:
+ *
+ * @code
+ *          track_generator.sortTracks()
+ *          track_generator.partitionTracks(num_threads)
+ * @endcode
+ *
+ * @param num_partitions the number of partitions in each halfspace
+ */
+void TrackGenerator::partitionTracks(int num_partitions) {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to partition Tracks since Tracks have not yet "
+               "been generated");
+
+  if (num_partitions <= 0)
+    log_printf(ERROR, "Unable to partition Tracks into %d partitions since "
+               "it is less than or equal to 0", num_partitions);
+
+  clearTrackPartitioning();
+
+  _num_partitions = num_partitions;
+  _partition_offsets = new int[2 * (num_partitions + 1)];
+
+  for (int h=0; h < 2; h++) {
+
+    int min_track = h * (_tot_num_tracks / 2);
+    int max_track = (h + 1) * (_tot_num_tracks / 2);
+    int* offsets = &_partition_offsets[h * (num_partitions + 1)];
+    long tot_num_segments = 0;
+    long cum_num_segments = 0;
+    int p = 1;
+
+    for (int uid=min_track; uid < max_track; uid++)
+      tot_num_segments += _num_segments[uid];
+
+    offsets[0] = min_track;
+
+    for (int t=min_track; t < max_track; t++) {
+      int uid = (_sorted_tracks != NULL) ? _sorted_tracks[t] : t;
+      cum_num_segments += _num_segments[uid];
+
+      while (p < num_partitions &&
+             cum_num_segments * num_partitions >= tot_num_segments * p) {
+        offsets[p] = t + 1;
+        p++;
+      }
+    }
+
+    for (; p <= num_partitions; p++)
+      offsets[p] = max_track;
+  }
+
+  log_printf(INFO, "Partitioned Tracks into %d ranges in each azimuthal "
+             "angle halfspace", num_partitions);
+}
+
+
+/**
+ * @brief Renumbers the FSRs such that FSRs which are close to each other
+ *        have nearby internal FSR IDs.
+ * @details The centroid of each FSR is computed from the Track segments
+ *          in the FSR, and the FSRs are numbered in order of the index of
+ *          their centroids along a Hilbert curve through the Geometry. The
+ *          Solvers store the scalar fluxes, sources and Materials for each
+ *          FSR in arrays indexed by these internal FSR IDs, such that the
+ *          FSRs crossed by a Track share fewer cache lines. The FSR IDs of
+ *          the Track segments are renumbered, while the Geometry maps the
+ *          internal FSR IDs to the FSR IDs such that FSRs are identified by
+ *          the same IDs as without renumbering by all methods which take or
+ *          return FSR IDs. FSRs which are not crossed by any Track segment
+ *          are numbered last. This method may be called from Python after
+ *          the Tracks are generated and before the Solver converges the
+ *          source:
+ *
+ * @code
+ *          track_generator.generateTracks()
+ *          track_generator.renumberFSRs()
+ * @endcode
+ */
+void TrackGenerator::renumberFSRs() {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to renumber FSRs since Tracks have not yet "
+               "been generated");
+
+  log_printf(NORMAL, "Renumbering FSRs for spatially coherent data...");
+
+  int num_FSRs = _geometry->getNumFSRs();
+
+  /* Accumulate the length-weighted midpoints of the segments in each FSR
+   * indexed by FSR ID */
+  double* x = new double[num_FSRs];
+  double* y = new double[num_FSRs];
+  double* lengths = new double[num_FSRs];
+
+  for (int r=0; r < num_FSRs; r++) {
+    x[r] = 0.;
+    y[r] = 0.;
+    lengths[r] = 0.;
+  }
+
+  for (int i=0; i < _num_azim; i++) {
+    for (int j=0; j < _num_tracks[i]; j++) {
+
+      Track* track = &_tracks[i][j];
+      segment* segments = track->getSegments();
+      double x0 = track->getStart()->getX();
+      double y0 = track->getStart()->getY();
+      double cos_phi = cos(track->getPhi());
+      double sin_phi = sin(track->getPhi());
+
+      for (int s=0; s < track->getNumSegments(); s++) {
+        double length = segments[s]._length;
+        int fsr_id = _geometry->getFSRId(segments[s]._region_id);
+
+        x[fsr_id] += length * (x0 + cos_phi * length / 2.);
+        y[fsr_id] += length * (y0 + sin_phi * length / 2.);
+        lengths[fsr_id] += length;
+
+        x0 += cos_phi * length;
+        y0 += sin_phi * length;
+      }
+    }
+  }
+
+  /* Compute the centroids and their bounding box */
+  double x_min = std::numeric_limits<double>::max();
+  double y_min = std::numeric_limits<double>::max();
+  double x_max = -std::numeric_limits<double>::max();
+  double y_max = -std::numeric_limits<double>::max();
+
+  for (int r=0; r < num_FSRs; r++) {
+    if (lengths[r] > 0.) {
+      x[r] /= lengths[r];
+      y[r] /= lengths[r];
+
+      x_min = std::min(x_min, x[r]);
+      y_min = std::min(y_min, y[r]);
+      x_max = std::max(x_max, x[r]);
+      y_max = std::max(y_max, y[r]);
+    }
+  }
+
+  /* Find the order of the Hilbert curve with at least one grid cell for
+   * each FSR */
+  int order = 0;
+
+  while (order < MAX_HILBERT_CURVE_ORDER && (1L << (2 * order)) < num_FSRs)
+    order++;
+
+  int num_cells = 1 << order;
+  double cell_width = std::max(x_max - x_min, y_max - y_min) / num_cells;
+
+  if (cell_width <= 0.)
+    cell_width = 1.;
+
+  /* Sort the FSRs by Hilbert curve index and then by FSR ID */
+  std::vector< std::pair<long, int> > sorted;
+
+  for (int r=0; r < num_FSRs; r++) {
+    long index = std::numeric_limits<long>::max();
+
+    if (lengths[r] > 0.) {
+      int x_cell = std::min(int((x[r] - x_min) / cell_width), num_cells-1);
+      int y_cell = std::min(int((y[r] - y_min) / cell_width), num_cells-1);
+      index = hilbertCurveIndex(x_cell, y_cell, order);
+    }
+
+    sorted.push_back(std::make_pair(index, r));
+  }
+
+  std::sort(sorted.begin(), sorted.end());
+
+  /* Map the current internal FSR IDs of the segments to the new ones */
+  int* fsr_ids = new int[num_FSRs];
+  int* new_internal_ids = new int[num_FSRs];
+
+  for (int r=0; r < num_FSRs; r++) {
+    fsr_ids[r] = sorted[r].second;
+    new_internal_ids[_geometry->getInternalFSRId(fsr_ids[r])] = r;
+  }
+
+  _geometry->renumberFSRs(fsr_ids, num_FSRs);
+
+  #pragma omp parallel for schedule(guided)
+  for (int s=0; s < _tot_num_segments; s++)
+    _segments[s]._region_id = new_internal_ids[_segments[s]._region_id];
+
+  delete [] x;
+  delete [] y;
+  delete [] lengths;
+  delete [] fsr_ids;
+  delete [] new_internal_ids;
+
+  log_printf(INFO, "Renumbered FSRs along a Hilbert curve with %d x %d "
+             "cells", num_cells, num_cells);
+}
@@ -16,11 +16,23 @@
 #include <sstream>
 #include <unistd.h>
 #include <omp.h>
+#include <vector>
+#include <algorithm>
 #include "Track.h"
 #include "Geometry.h"
+#include "numa.h"
 #endif
 
 
+/** The maximum number of bits for each coordinate of the Hilbert curve
+ *  used to sort Tracks by their midpoints and FSRs by their centroids */
+#define MAX_HILBERT_CURVE_ORDER 16
+
+/** The minimum average number of Tracks in each azimuthal angle halfspace
+ *  with their midpoints in the same cell of the Hilbert curve */
+#define TRACK_BUNDLE_SIZE 32
+
+
 /**
  * @class TrackGenerator TrackGenerator.h "src/TrackGenerator.h"
  * @brief The TrackGenerator is dedicated to generating and storing Tracks
@@ -38,6 +50,10 @@ private:
   /** The track spacing (cm) */
   double _spacing;
 
+  /** Whether to split segments to bound their optical length (true) or
+   *  not (false) */
+  bool _segment_splitting;
+
   /** An integer array of the number of Tracks for each azimuthal angle */
   int* _num_tracks;
 
@@ -50,6 +66,12 @@ private:
   /** The total number of segments for all Tracks */
   int _tot_num_segments;
 
+  /** A contiguous array of the segments for all Tracks ordered by Track UID */
+  segment* _segments;
+
+  /** The pages backing the array of segments */
+  hugePageType _huge_pages;
+
   /** An integer array of the number of Tracks starting on the x-axis for each
    *  azimuthal angle */
   int* _num_x;
@@ -76,6 +98,28 @@ private:
   /** Boolean whether the Tracks have been generated (true) or not (false) */
   bool _contains_tracks;
 
+  /** The number of Track colors in each azimuthal angle halfspace */
+  int _num_colors[2];
+
+  /** Offsets into the array of colored Track UIDs for each color */
+  int* _color_offsets;
+
+  /** An array of Track UIDs sorted by azimuthal halfspace and color such
+   *  that Tracks with the same color do not cross any of the same FSRs */
+  int* _colored_tracks;
+
+  /** An array of Track UIDs sorted within each azimuthal angle halfspace
+   *  along a Hilbert curve through the Track midpoints */
+  int* _sorted_tracks;
+
+  /** The number of partitions of the Tracks in each azimuthal angle
+   *  halfspace */
+  int _num_partitions;
+
+  /** Offsets into the Tracks in sweep order for each partition in each
+   *  azimuthal angle halfspace */
+  int* _partition_offsets;
+
   void computeEndPoint(Point* start, Point* end,  const double phi,
                        const double width, const double height);
 
@@ -84,8 +128,15 @@ private:
   void recalibrateTracksToOrigin();
   void initializeBoundaryConditions();
   void segmentize();
+  void allocateSegments();
   void dumpTracksToFile();
   bool readTracksFromFile();
+  void clearTrackColoring();
+  void clearTrackOrdering();
+  void clearTrackPartitioning();
+  void findTrackResources(Track* track, bool cmfd_on,
+                          std::vector<int>& resources);
+  long hilbertCurveIndex(int x, int y, int order);
 
 public:
   TrackGenerator(Geometry* geometry, int num_azim, double spacing);
@@ -98,18 +149,40 @@ public:
   int* getNumTracksArray();
   int getNumSegments();
   int* getNumSegmentsArray();
+  segment* getSegments();
   Track** getTracks();
   FP_PRECISION* getAzimWeights();
+  bool getSegmentSplitting();
+  hugePageType getHugePages();
+  FP_PRECISION getMaxOpticalLength();
+  int getNumColors();
+  int getNumColors(int halfspace);
+  int getNumTracksWithColor(int color);
+  int getNumSegmentsWithColor(int color);
+  int* getColorOffsets();
+  int* getColoredTracks();
+  int* getSortedTracks();
+  int getNumPartitions();
+  int* getPartitionOffsets();
 
   void setNumAzim(int num_azim);
   void setTrackSpacing(double spacing);
+  void setSegmentSplitting(bool splitting);
+  void setHugePages(hugePageType huge_pages);
   void setGeometry(Geometry* geometry);
 
   bool containsTracks();
+  bool containsTrackColoring();
+  bool containsTrackOrdering();
+  bool containsTrackPartitioning();
   void retrieveTrackCoords(double* coords, int num_tracks);
   void retrieveSegmentCoords(double* coords, int num_segments);
 
   void generateTracks();
+  void colorTracks();
+  void sortTracks();
+  void partitionTracks(int num_partitions);
+  void renumberFSRs();
 };
 
 #endif /* TRACKGENERATOR_H_ */
@@ -32,7 +32,7 @@ VectorizedPrivateSolver::~VectorizedPrivateSolver() {
   if (_thread_flux != NULL) {
 
     for (int t=0; t < _num_threads; t++)
-      _mm_free(_thread_flux[t]);
+      simd_free(_thread_flux[t]);
 
     delete [] _thread_flux;
     _thread_flux = NULL;
@@ -80,7 +80,7 @@ void VectorizedPrivateSolver::initializeFluxArrays() {
   if (_thread_flux != NULL) {
 
     for (int t=0; t < _num_threads; t++)
-      _mm_free(_thread_flux[t]);
+      simd_free(_thread_flux[t]);
 
     delete [] _thread_flux;
   }
@@ -93,7 +93,7 @@ void VectorizedPrivateSolver::initializeFluxArrays() {
     size = _num_FSRs * _num_groups * sizeof(FP_PRECISION);
 
     for (int t=0; t < _num_threads; t++)
-      _thread_flux[t] = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+      _thread_flux[t] = (FP_PRECISION*)simd_malloc(size);
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the "
@@ -119,11 +119,7 @@ void VectorizedPrivateSolver::scalarFluxTally(segment* curr_segment,
 
   int tid = omp_get_thread_num();
   int fsr_id = curr_segment->_region_id;
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
 
-  /* The change in angular flux along this Track segment in the FSR */
-  FP_PRECISION delta_psi;
   FP_PRECISION* exponentials = &_thread_exponentials[tid*_polar_times_groups];
 
   computeExponentials(curr_segment, exponentials);
@@ -136,9 +132,9 @@ void VectorizedPrivateSolver::scalarFluxTally(segment* curr_segment,
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH) private(delta_psi)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
-        delta_psi = (track_flux(p,e) - _reduced_source(fsr_id,e)) *
+        FP_PRECISION delta_psi = (track_flux(p,e) - _reduced_source(fsr_id,e)) *
                    exponentials(p,e);
         fsr_flux[e] += delta_psi * _polar_weights(azim_index,p);
         track_flux(p,e) -= delta_psi;
@@ -233,12 +229,10 @@ void VectorizedPrivateSolver::transportSweep() {
  */
 void VectorizedPrivateSolver::reduceThreadScalarFluxes() {
 
-  for (int tid=0; tid < _num_threads; tid++) {
-    for (int r=0; r < _num_FSRs; r++) {
-      for (int e=0; e < _num_groups; e++) {
-        _scalar_flux(r,e) += _thread_flux(tid,r,e);
-      }
-    }
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int tid=0; tid < _num_threads; tid++)
+      simd_add(_num_groups, &_thread_flux(tid,r,0), &_scalar_flux(r,0));
   }
 
   return;
@@ -24,8 +24,8 @@
  * @brief This is a subclass of the VectorizedSolver class. This class uses a
  *        thread private array for FSR scalar fluxes during each transport sweep
  *        to avoid the use of OpenMP atomics, akin to the ThreadPrivateSolver
- *        class. It also uses memory-aligned data structures and Intel's
- *        auto-vectorization
+ *        class. It also uses memory-aligned data structures and SIMD
+ *        vectorization.
  */
 class VectorizedPrivateSolver : public VectorizedSolver {
 
@@ -20,6 +20,10 @@ VectorizedSolver::VectorizedSolver(Geometry* geometry,
 
   _thread_taus = NULL;
   _thread_exponentials = NULL;
+  _num_unpadded_groups = 0;
+  _track_parallel_sweep = true;
+  _lane_buffer_size = 0;
+  _thread_lane_buffers = NULL;
 
   if (geometry != NULL)
     setGeometry(geometry);
@@ -27,7 +31,7 @@ VectorizedSolver::VectorizedSolver(Geometry* geometry,
   if (track_generator != NULL)
     setTrackGenerator(track_generator);
 
-  vmlSetMode(VML_EP);
+  initialize_simd();
 }
 
 
@@ -38,60 +42,64 @@ VectorizedSolver::VectorizedSolver(Geometry* geometry,
 VectorizedSolver::~VectorizedSolver() {
 
   if (_boundary_flux != NULL) {
-    _mm_free(_boundary_flux);
+    simd_free(_boundary_flux);
     _boundary_flux = NULL;
   }
 
   if (_boundary_leakage != NULL) {
-    _mm_free(_boundary_leakage);
+    simd_free(_boundary_leakage);
     _boundary_leakage = NULL;
   }
 
   if (_scalar_flux != NULL) {
-    _mm_free(_scalar_flux);
+    simd_free(_scalar_flux);
     _scalar_flux = NULL;
   }
 
   if (_thread_fsr_flux != NULL) {
-    _mm_free(_thread_fsr_flux);
+    simd_free(_thread_fsr_flux);
     _thread_fsr_flux = NULL;
   }
 
   if (_fission_sources != NULL) {
-    _mm_free(_fission_sources);
+    simd_free(_fission_sources);
     _fission_sources = NULL;
   }
 
   if (_scatter_sources != NULL) {
-    _mm_free(_scatter_sources);
+    simd_free(_scatter_sources);
     _scatter_sources = NULL;
   }
 
   if (_source != NULL) {
-    _mm_free(_source);
+    simd_free(_source);
     _source = NULL;
   }
 
   if (_old_source != NULL) {
-    _mm_free(_old_source);
+    simd_free(_old_source);
     _old_source = NULL;
   }
 
   if (_reduced_source != NULL) {
-    _mm_free(_reduced_source);
+    simd_free(_reduced_source);
     _reduced_source = NULL;
   }
 
   if (_thread_taus != NULL) {
-    _mm_free(_thread_taus);
+    simd_free(_thread_taus);
     _thread_taus = NULL;
   }
 
   if (_thread_exponentials != NULL) {
-    _mm_free(_thread_exponentials);
+    simd_free(_thread_exponentials);
     _thread_exponentials = NULL;
   }
 
+  if (_thread_lane_buffers != NULL) {
+    simd_free(_thread_lane_buffers);
+    _thread_lane_buffers = NULL;
+  }
 }
 
 
@@ -108,6 +116,55 @@ int VectorizedSolver::getNumVectorWidths() {
 }
 
 
+/**
+ * @brief Returns whether the Tracks are swept in bundles with one Track in
+ *        each vector lane.
+ * @details The Tracks are swept in bundles for up to TRACK_SIMD_MAX_GROUPS
+ *          energy groups with the HALFSPACE_SWEEP sweep type and without
+ *          CMFD acceleration, unless disabled with
+ *          VectorizedSolver::setTrackParallelSweep(...).
+ * @return whether the Tracks are swept in bundles
+ */
+bool VectorizedSolver::isUsingTrackParallelSweep() {
+  return _track_parallel_sweep &&
+         _num_unpadded_groups <= TRACK_SIMD_MAX_GROUPS &&
+         _sweep_type == HALFSPACE_SWEEP &&
+         !_cmfd->getMesh()->getCmfdOn();
+}
+
+
+/**
+ * @brief Sets whether each source iteration runs in a single parallel region.
+ * @details The vectorized source and rate kernels fork their own teams of
+ *          threads, so a persistent parallel region is not supported.
+ * @param persistent whether to use a persistent parallel region
+ */
+void VectorizedSolver::setPersistentParallelRegion(bool persistent) {
+
+  if (persistent)
+    log_printf(ERROR, "Unable to use a persistent parallel region for the "
+               "source iterations of a VectorizedSolver");
+}
+
+
+/**
+ * @brief Sets whether the Tracks may be swept in bundles with one Track in
+ *        each vector lane for small numbers of energy groups.
+ * @details This is enabled by default, such that one and two group problems
+ *          vectorize across Tracks rather than padded energy groups. It may
+ *          be disabled from Python as follows:
+ *
+ * @code
+ *          solver.setTrackParallelSweep(False)
+ * @endcode
+ *
+ * @param track_parallel whether to sweep the Tracks in bundles
+ */
+void VectorizedSolver::setTrackParallelSweep(bool track_parallel) {
+  _track_parallel_sweep = track_parallel;
+}
+
+
 /**
  * @brief Sets the Geometry for the Solver and aligns all Material
  * cross-section data for SIMD vector instructions.
@@ -117,6 +174,8 @@ void VectorizedSolver::setGeometry(Geometry* geometry) {
 
   CPUSolver::setGeometry(geometry);
 
+  _num_unpadded_groups = _num_groups;
+
   /* Compute the number of SIMD vector widths needed to fit energy groups */
   _num_vector_lengths = (_num_groups / VEC_LENGTH) + 1;
 
@@ -146,14 +205,14 @@ void VectorizedSolver::buildExpInterpTable() {
   /* Deallocates memory for the exponentials if it was allocated for a
    * previous simulation */
   if (_thread_exponentials != NULL)
-    _mm_free(_thread_exponentials);
+    simd_free(_thread_exponentials);
 
   /* Allocates memory for an array of exponential values for each thread
    * - this is not used by default, but can be to allow for vectorized
    * evaluation of the exponentials. Unfortunately this does not appear
    * to give any performance boost. */
   int size = _num_threads * _polar_times_groups * sizeof(FP_PRECISION);
-  _thread_exponentials = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+  _thread_exponentials = (FP_PRECISION*)simd_malloc(size);
 }
 
 
@@ -166,21 +225,29 @@ void VectorizedSolver::buildExpInterpTable() {
  */
 void VectorizedSolver::initializeFluxArrays() {
 
+  if (_boundary_flux_single_precision)
+    log_printf(ERROR, "Unable to store the boundary fluxes in single "
+               "precision since this is not supported by the "
+               "VectorizedSolver");
+
   /* Delete old flux arrays if they exist */
   if (_boundary_flux != NULL)
-    _mm_free(_boundary_flux);
+    simd_free(_boundary_flux);
 
   if (_boundary_leakage != NULL)
-    _mm_free(_boundary_leakage);
+    simd_free(_boundary_leakage);
 
   if (_scalar_flux != NULL)
-    _mm_free(_scalar_flux);
+    simd_free(_scalar_flux);
 
   if (_thread_fsr_flux != NULL)
-    _mm_free(_thread_fsr_flux);
+    simd_free(_thread_fsr_flux);
 
   if (_thread_taus != NULL)
-    _mm_free(_thread_taus);
+    simd_free(_thread_taus);
+
+  if (_thread_lane_buffers != NULL)
+    simd_free(_thread_lane_buffers);
 
   int size;
 
@@ -189,18 +256,31 @@ void VectorizedSolver::initializeFluxArrays() {
 
     size = 2 * _tot_num_tracks * _num_groups * _num_polar;
     size *= sizeof(FP_PRECISION);
-    _boundary_flux = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
-    _boundary_leakage = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+    _boundary_flux = (FP_PRECISION*)simd_malloc(size);
+    _boundary_leakage = (FP_PRECISION*)simd_malloc(size);
+
+    /* The leakage of the padding groups is never tallied by the Track
+     * bundles and must remain zero */
+    memset(_boundary_leakage, 0, size);
 
     size = _num_FSRs * _num_groups * sizeof(FP_PRECISION);
-    _scalar_flux = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+    _scalar_flux = (FP_PRECISION*)simd_malloc(size);
 
     size = _num_threads * _num_groups * sizeof(FP_PRECISION);
-    _thread_fsr_flux = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+    _thread_fsr_flux = (FP_PRECISION*)simd_malloc(size);
+    memset(_thread_fsr_flux, 0, size);
 
     size = _num_threads * _polar_times_groups * sizeof(FP_PRECISION);
-    _thread_taus = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
-
+    _thread_taus = (FP_PRECISION*)simd_malloc(size);
+
+    /* The angular fluxes, exponentials and optical lengths for each polar
+     * angle, the FSR fluxes, cross-sections and sources, the polar weights,
+     * the segment lengths and masks of each vector lane */
+    _lane_buffer_size = VEC_LENGTH * (3 * _num_polar * _num_unpadded_groups +
+                                      3 * _num_unpadded_groups +
+                                      _num_polar + 2);
+    size = _num_threads * _lane_buffer_size * sizeof(FP_PRECISION);
+    _thread_lane_buffers = (FP_PRECISION*)simd_malloc(size);
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the VectorizedSolver's "
@@ -218,38 +298,38 @@ void VectorizedSolver::initializeSourceArrays() {
 
   /* Delete old sources arrays if they exist */
   if (_fission_sources != NULL)
-    _mm_free(_fission_sources);
+    simd_free(_fission_sources);
 
   if (_scatter_sources != NULL)
-    _mm_free(_scatter_sources);
+    simd_free(_scatter_sources);
 
   if (_source != NULL)
-    _mm_free(_source);
+    simd_free(_source);
 
   if (_old_source != NULL)
-    _mm_free(_old_source);
+    simd_free(_old_source);
 
   if (_reduced_source != NULL)
-    _mm_free(_reduced_source);
+    simd_free(_reduced_source);
 
   if (_source_residuals != NULL)
-    _mm_free(_source_residuals);
+    simd_free(_source_residuals);
 
   int size;
 
   /* Allocate aligned memory for all source arrays */
   try{
     size = _num_FSRs * _num_groups * sizeof(FP_PRECISION);
-    _fission_sources = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
-    _source = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
-    _old_source = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
-    _reduced_source = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+    _fission_sources = (FP_PRECISION*)simd_malloc(size);
+    _source = (FP_PRECISION*)simd_malloc(size);
+    _old_source = (FP_PRECISION*)simd_malloc(size);
+    _reduced_source = (FP_PRECISION*)simd_malloc(size);
 
     size = _num_threads * _num_groups * sizeof(FP_PRECISION);
-    _scatter_sources = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+    _scatter_sources = (FP_PRECISION*)simd_malloc(size);
 
     size = _num_FSRs * sizeof(FP_PRECISION);
-    _source_residuals = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+    _source_residuals = (FP_PRECISION*)simd_malloc(size);
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the VectorizedSolver's "
@@ -282,7 +362,7 @@ void VectorizedSolver::normalizeFluxes() {
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over each energy group within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
         _fission_sources(r,e) = nu_sigma_f[e] * _scalar_flux(r,e);
         _fission_sources(r,e) *= volume;
@@ -292,11 +372,7 @@ void VectorizedSolver::normalizeFluxes() {
 
   /* Compute the total fission source */
   int size = _num_FSRs * _num_groups;
-  #ifdef SINGLE
-  tot_fission_source = cblas_sasum(size, _fission_sources, 1);
-  #else
-  tot_fission_source = cblas_dasum(size, _fission_sources, 1);
-  #endif
+  tot_fission_source = simd_sum(size, _fission_sources);
 
   /* Compute the normalization factor */
   norm_factor = 1.0 / tot_fission_source;
@@ -305,20 +381,12 @@ void VectorizedSolver::normalizeFluxes() {
              tot_fission_source, norm_factor);
 
   /* Normalize the FSR scalar fluxes */
-  #ifdef SINGLE
-  cblas_sscal(size, norm_factor, _scalar_flux, 1);
-  #else
-  cblas_dscal(size, norm_factor, _scalar_flux, 1);
-  #endif
+  simd_scale(size, norm_factor, _scalar_flux);
 
   /* Normalize the Track angular boundary fluxes */
   size = 2 * _tot_num_tracks * _num_polar * _num_groups;
 
-  #ifdef SINGLE
-  cblas_sscal(size, norm_factor, _boundary_flux, 1);
-  #else
-  cblas_dscal(size, norm_factor, _boundary_flux, 1);
-  #endif
+  simd_scale(size, norm_factor, _boundary_flux);
 
   return;
 }
@@ -352,7 +420,7 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
   FP_PRECISION inverse_k_eff = 1.0 / _k_eff;
 
   /* For all FSRs, find the source */
-  #pragma omp parallel for private(material, nu_sigma_f, chi, \
+  #pragma omp parallel for private(tid, material, nu_sigma_f, chi, \
     sigma_s, sigma_t, fission_source, scatter_source) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
 
@@ -371,16 +439,12 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
       for (int v=0; v < _num_vector_lengths; v++) {
 
         /* Compute fission source for each group */
-        #pragma simd vectorlength(VEC_LENGTH)
+        VECTOR_LOOP
         for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
           _fission_sources(r,e) = _scalar_flux(r,e) * nu_sigma_f[e];
       }
 
-      #ifdef SINGLE
-      fission_source = cblas_sasum(_num_groups, &_fission_sources(r,0),1);
-      #else
-      fission_source = cblas_dasum(_num_groups, &_fission_sources(r,0),1);
-      #endif
+      fission_source = simd_sum(_num_groups, &_fission_sources(r,0));
 
       fission_source *= inverse_k_eff;
     }
@@ -394,17 +458,13 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
 
       for (int v=0; v < _num_vector_lengths; v++) {
 
-        #pragma simd vectorlength(VEC_LENGTH)
+        VECTOR_LOOP
         for (int g=v*VEC_LENGTH; g < (v+1)*VEC_LENGTH; g++)
           _scatter_sources(tid,g) = sigma_s[G*_num_groups+g] *
                                     _scalar_flux(r,g);
       }
 
-      #ifdef SINGLE
-      scatter_source=cblas_sasum(_num_groups,&_scatter_sources(tid,0),1);
-      #else
-      scatter_source=cblas_dasum(_num_groups,&_scatter_sources(tid,0),1);
-      #endif
+      scatter_source = simd_sum(_num_groups, &_scatter_sources(tid,0));
 
       /* Set the total source for FSR r in group G */
       _source(r,G) = (fission_source * chi[G] + scatter_source)
@@ -423,11 +483,7 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
   }
 
   /* Sum up the residuals from each group and in each FSR */
-  #ifdef SINGLE
-  source_residual = cblas_sasum(_num_FSRs,_source_residuals,1);
-  #else
-  source_residual = cblas_dasum(_num_FSRs,_source_residuals,1);
-  #endif
+  source_residual = simd_sum(_num_FSRs, _source_residuals);
 
   source_residual = sqrt(source_residual / (_num_groups * _num_FSRs));
 
@@ -457,7 +513,7 @@ void VectorizedSolver::addSourceToScalarFlux() {
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
         _scalar_flux(r,e) *= 0.5;
         _scalar_flux(r,e) = FOUR_PI * _reduced_source(r,e) +
@@ -491,10 +547,10 @@ void VectorizedSolver::computeKeff() {
   FP_PRECISION tot_fission = 0.0;
 
   int size = _num_FSRs * sizeof(FP_PRECISION);
-  FP_PRECISION* FSR_rates = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+  FP_PRECISION* FSR_rates = (FP_PRECISION*)simd_malloc(size);
 
   size = _num_threads * _num_groups * sizeof(FP_PRECISION);
-  FP_PRECISION* group_rates = (FP_PRECISION*)_mm_malloc(size, VEC_ALIGNMENT);
+  FP_PRECISION* group_rates = (FP_PRECISION*)simd_malloc(size);
 
   /* Loop over all FSRs and compute the volume-weighted absorption rates */
   #pragma omp parallel for private(tid, volume, \
@@ -510,24 +566,16 @@ void VectorizedSolver::computeKeff() {
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
         group_rates[tid+e] = sigma_a[e] * _scalar_flux(r,e);
     }
 
-    #ifdef SINGLE
-    FSR_rates[r] = cblas_sasum(_num_groups, &group_rates[tid], 1) * volume;
-    #else
-    FSR_rates[r] = cblas_dasum(_num_groups, &group_rates[tid], 1) * volume;
-    #endif
+    FSR_rates[r] = simd_sum(_num_groups, &group_rates[tid]) * volume;
   }
 
   /* Reduce absorption and fission rates across FSRs, energy groups */
-  #ifdef SINGLE
-  tot_abs = cblas_sasum(_num_FSRs, FSR_rates, 1);
-  #else
-  tot_abs = cblas_dasum(_num_FSRs, FSR_rates, 1);
-  #endif
+  tot_abs = simd_sum(_num_FSRs, FSR_rates);
 
   /* Loop over all FSRs and compute the volume-weighted fission rates */
   #pragma omp parallel for private(tid, volume, \
@@ -543,41 +591,29 @@ void VectorizedSolver::computeKeff() {
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
         group_rates[tid+e] = nu_sigma_f[e] * _scalar_flux(r,e);
     }
 
-    #ifdef SINGLE
-    FSR_rates[r] = cblas_sasum(_num_groups, &group_rates[tid], 1) * volume;
-    #else
-    FSR_rates[r] = cblas_dasum(_num_groups, &group_rates[tid], 1) * volume;
-    #endif
+    FSR_rates[r] = simd_sum(_num_groups, &group_rates[tid]) * volume;
   }
 
   /* Reduce fission rates across FSRs */
-  #ifdef SINGLE
-  tot_fission = cblas_sasum(_num_FSRs, FSR_rates, 1);
-  #else
-  tot_fission = cblas_dasum(_num_FSRs, FSR_rates, 1);
-  #endif
+  tot_fission = simd_sum(_num_FSRs, FSR_rates);
 
   /** Reduce leakage array across tracks, energy groups, polar angles */
   size = 2 * _tot_num_tracks * _polar_times_groups;
 
-  #ifdef SINGLE
-  _leakage = cblas_sasum(size, _boundary_leakage, 1) * 0.5;
-  #else
-  _leakage = cblas_dasum(size, _boundary_leakage, 1) * 0.5;
-  #endif
+  _leakage = simd_sum(size, _boundary_leakage) * 0.5;
 
   _k_eff = tot_fission / (tot_abs + _leakage);
 
   log_printf(DEBUG, "abs = %f, fission = %f, leakage = %f, k_eff = %f",
              tot_abs, tot_fission, _leakage, _k_eff);
 
-  _mm_free(FSR_rates);
-  _mm_free(group_rates);
+  simd_free(FSR_rates);
+  simd_free(group_rates);
 
 return;
 }
@@ -587,34 +623,26 @@ return;
 /**
  * @brief Computes the contribution to the FSR scalar flux from a Track segment.
  * @details This method integrates the angular flux for a Track segment across
- *        energy groups and polar angles, and tallies it into the FSR scalar
- *        flux, and updates the Track's angular flux.
+ *        energy groups and polar angles, and tallies it into the temporary
+ *        FSR scalar flux buffer, and updates the Track's angular flux. The
+ *        buffer is flushed by the CPUSolver::accumulateScalarFlux(...) routine.
  * @param curr_segment a pointer to the Track segment of interest
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param track_flux a pointer to the Track's angular flux
  * @param fsr_flux a pointer to the temporary FSR flux buffer
- * @param fwd
  */
 void VectorizedSolver::scalarFluxTally(segment* curr_segment,
                                        int azim_index,
                                        FP_PRECISION* track_flux,
-                                       FP_PRECISION* fsr_flux,
-                                       bool fwd){
+                                       FP_PRECISION* fsr_flux){
 
   int tid = omp_get_thread_num();
   int fsr_id = curr_segment->_region_id;
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
 
-  /* The change in angular flux along this Track segment in the FSR */
-  FP_PRECISION delta_psi;
   FP_PRECISION* exponentials = &_thread_exponentials[tid*_polar_times_groups];
 
   computeExponentials(curr_segment, exponentials);
 
-  /* Set the FSR scalar flux buffer to zero */
-  memset(fsr_flux, 0.0, _num_groups * sizeof(FP_PRECISION));
-
   /* Tally the flux contribution from segment to FSR's scalar flux */
   /* Loop over polar angles */
   for (int p=0; p < _num_polar; p++){
@@ -623,9 +651,9 @@ void VectorizedSolver::scalarFluxTally(segment* curr_segment,
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH) private(delta_psi)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
-        delta_psi = (track_flux(p,e) - _reduced_source(fsr_id,e)) *
+        FP_PRECISION delta_psi = (track_flux(p,e) - _reduced_source(fsr_id,e)) *
                    exponentials(p,e);
         fsr_flux[e] += delta_psi * _polar_weights(azim_index,p);
         track_flux(p,e) -= delta_psi;
@@ -633,19 +661,6 @@ void VectorizedSolver::scalarFluxTally(segment* curr_segment,
     }
   }
 
-  /* Atomically increment the FSR scalar flux from the temporary array */
-  omp_set_lock(&_FSR_locks[fsr_id]);
-  {
-    #ifdef SINGLE
-    vsAdd(_num_groups, &_scalar_flux(fsr_id,0), fsr_flux,
-          &_scalar_flux(fsr_id,0));
-    #else
-    vdAdd(_num_groups, &_scalar_flux(fsr_id,0), fsr_flux,
-          &_scalar_flux(fsr_id,0));
-    #endif
-  }
-  omp_unset_lock(&_FSR_locks[fsr_id]);
-
   return;
 }
 
@@ -661,7 +676,8 @@ void VectorizedSolver::computeExponentials(segment* curr_segment,
                                            FP_PRECISION* exponentials) {
 
   FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  FP_PRECISION* sigma_t =
+       _FSR_materials[curr_segment->_region_id]->getSigmaT();
 
   /* Evaluate the exponentials using the linear interpolation table */
   if (_interpolate_exponential) {
@@ -679,6 +695,24 @@ void VectorizedSolver::computeExponentials(segment* curr_segment,
     }
   }
 
+  /* Evaluate the exponentials using the polynomial */
+  else if (_polynomial_exponential) {
+
+    FP_PRECISION* sinthetas = _quad->getSinThetas();
+
+    for (int p=0; p < _num_polar; p++) {
+
+      for (int v=0; v < _num_vector_lengths; v++) {
+
+        VECTOR_LOOP
+        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+          exponentials(p,e) = exponential_poly(sigma_t[e] * length /
+                              sinthetas[p], _exp_poly_coefficients,
+                              _exp_poly_degree);
+      }
+    }
+  }
+
   /* Evalute the exponentials using the intrinsic exp(...) function */
   else {
 
@@ -692,25 +726,21 @@ void VectorizedSolver::computeExponentials(segment* curr_segment,
 
       for (int v=0; v < _num_vector_lengths; v++) {
 
-        #pragma simd vectorlength(VEC_LENGTH)
+        VECTOR_LOOP
         for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
           taus(p,e) = -sigma_t[e] * length / sinthetas[p];
       }
     }
 
-    /* Evaluate the negative of the exponentials using Intel's MKL */
-    #ifdef SINGLE
-    vsExp(_polar_times_groups, taus, exponentials);
-    #else
-    vdExp(_polar_times_groups, taus, exponentials);
-    #endif
+    /* Evaluate the exponentials with the vector kernel */
+    simd_exp(_polar_times_groups, taus, exponentials);
 
     /* Compute one minus the exponentials */
     for (int p=0; p < _num_polar; p++) {
 
       for (int v=0; v < _num_vector_lengths; v++) {
 
-        #pragma simd vectorlength(VEC_LENGTH)
+        VECTOR_LOOP
         for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
           exponentials(p,e) = 1.0 - exponentials(p,e);
       }
@@ -765,7 +795,7 @@ void VectorizedSolver::transferBoundaryFlux(int track_id, int azim_index,
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      VECTOR_LOOP
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
         track_out_flux(p,e) = track_flux(p,e) * bc;
         track_leakage(p,e) = track_flux(p,e) *
@@ -774,3 +804,388 @@ void VectorizedSolver::transferBoundaryFlux(int track_id, int azim_index,
     }
   }
 }
+
+
+/**
+ * @brief This method performs one transport sweep of all azimuthal angles,
+ *        Tracks, Track segments, polar angles and energy groups.
+ * @details For up to TRACK_SIMD_MAX_GROUPS energy groups, the Tracks in each
+ *          azimuthal angle halfspace are swept in bundles of VEC_LENGTH
+ *          Tracks, with the segments of each Track stepped in lockstep in
+ *          one vector lane. Otherwise, the Tracks are swept one at a time
+ *          with vectors across energy groups by the CPUSolver.
+ */
+void VectorizedSolver::transportSweep() {
+
+  if (!isUsingTrackParallelSweep()) {
+    CPUSolver::transportSweep();
+    return;
+  }
+
+  /* The Tracks sorted for spatial locality if they have been sorted */
+  int* sorted_tracks = NULL;
+
+  if (_track_generator->containsTrackOrdering())
+    sorted_tracks = _track_generator->getSortedTracks();
+
+  int num_half_tracks = _tot_num_tracks / 2;
+  int num_bundles = (num_half_tracks + VEC_LENGTH - 1) / VEC_LENGTH;
+
+  /* Initialize flux in each FSR to zero */
+  flattenFSRFluxes(0.0);
+
+  log_printf(DEBUG, "Transport sweep of Track bundles with %d OpenMP "
+             "threads", _num_threads);
+
+  if (_sweep_report)
+    startSweepReport(_num_threads);
+
+  #pragma omp parallel
+  {
+    int track_ids[VEC_LENGTH];
+
+    /* Loop over azimuthal angle halfspaces */
+    for (int i=0; i < 2; i++) {
+
+      int min_track = i * num_half_tracks;
+      int max_track = (i + 1) * num_half_tracks;
+
+      /* Loop over each bundle of Tracks within this halfspace */
+      #pragma omp for schedule(guided)
+      for (int b=0; b < num_bundles; b++) {
+
+        int num_lanes = 0;
+        int first_track = min_track + b * VEC_LENGTH;
+        int last_track = std::min(first_track + VEC_LENGTH, max_track);
+
+        for (int t=first_track; t < last_track; t++)
+          track_ids[num_lanes++] = (sorted_tracks != NULL) ?
+                                   sorted_tracks[t] : t;
+
+        sweepTrackBundle(track_ids, num_lanes);
+      }
+    }
+  }
+
+  if (_sweep_report)
+    stopSweepReport();
+
+  return;
+}
+
+
+/**
+ * @brief Integrates the angular flux along a bundle of Tracks in the forward
+ *        and reverse directions with one Track in each vector lane.
+ * @details The segments of the Tracks are stepped in lockstep. The segment
+ *          lengths and the cross-sections and sources of their FSRs are
+ *          gathered for each lane, and the lanes whose Tracks have no
+ *          segments left are masked. The scalar flux for consecutive
+ *          segments of a Track in the same FSR is tallied into the lane's
+ *          FSR flux buffer, which is flushed once the Track leaves the FSR.
+ * @param track_ids the ID numbers for the Tracks in each lane
+ * @param num_lanes the number of Tracks in the bundle (up to VEC_LENGTH)
+ */
+void VectorizedSolver::sweepTrackBundle(int* track_ids, int num_lanes) {
+
+  const int num_groups = _num_unpadded_groups;
+  const int num_pe = _num_polar * num_groups;
+  int tid = omp_get_thread_num();
+
+  /* Partition the thread's buffer into arrays with one value per lane */
+  FP_PRECISION* lane_flux = &_thread_lane_buffers[tid * _lane_buffer_size];
+  FP_PRECISION* exponentials = &lane_flux[num_pe * VEC_LENGTH];
+  FP_PRECISION* taus = &exponentials[num_pe * VEC_LENGTH];
+  FP_PRECISION* lane_fsr_flux = &taus[num_pe * VEC_LENGTH];
+  FP_PRECISION* sigma_t = &lane_fsr_flux[num_groups * VEC_LENGTH];
+  FP_PRECISION* sources = &sigma_t[num_groups * VEC_LENGTH];
+  FP_PRECISION* weights = &sources[num_groups * VEC_LENGTH];
+  FP_PRECISION* lengths = &weights[_num_polar * VEC_LENGTH];
+  FP_PRECISION* mask = &lengths[VEC_LENGTH];
+
+  segment* segments[VEC_LENGTH];
+  segment* curr_segments[VEC_LENGTH];
+  int num_segments[VEC_LENGTH];
+  int fsr_ids[VEC_LENGTH];
+  bool flush[VEC_LENGTH];
+  int max_segments = 0;
+  int tot_segments = 0;
+
+  /* Initialize each lane from its Track, with empty lanes masked */
+  for (int w=0; w < VEC_LENGTH; w++) {
+
+    int azim_index = 0;
+    num_segments[w] = 0;
+
+    if (w < num_lanes) {
+      Track* curr_track = _tracks[track_ids[w]];
+      azim_index = curr_track->getAzimAngleIndex();
+      num_segments[w] = curr_track->getNumSegments();
+      segments[w] = curr_track->getSegments();
+    }
+
+    fsr_ids[w] = (num_segments[w] > 0) ? segments[w][0]._region_id : 0;
+    max_segments = std::max(max_segments, num_segments[w]);
+    tot_segments += num_segments[w];
+
+    for (int p=0; p < _num_polar; p++)
+      weights[p*VEC_LENGTH+w] = _polar_weights(azim_index,p);
+
+    for (int e=0; e < num_groups; e++)
+      lane_fsr_flux[e*VEC_LENGTH+w] = 0.0;
+  }
+
+  double start_time = 0.;
+
+  if (_sweep_report)
+    start_time = omp_get_wtime();
+
+  /* Loop over the forward and reverse directions */
+  for (int d=0; d < 2; d++) {
+
+    /* Load the incoming angular fluxes of each Track */
+    for (int w=0; w < VEC_LENGTH; w++) {
+      for (int p=0; p < _num_polar; p++) {
+        for (int e=0; e < num_groups; e++)
+          lane_flux[(p*num_groups+e)*VEC_LENGTH+w] = (w < num_lanes) ?
+               _boundary_flux(track_ids[w],d,p,e) : 0.0;
+      }
+    }
+
+    /* Loop over the segments of the Tracks in lockstep */
+    for (int step=0; step < max_segments; step++) {
+
+      /* Find the segment of each lane and whether it leaves its FSR */
+      for (int w=0; w < VEC_LENGTH; w++) {
+
+        flush[w] = false;
+
+        if (step < num_segments[w]) {
+          int s = (d == 0) ? step : num_segments[w] - 1 - step;
+          curr_segments[w] = &segments[w][s];
+          flush[w] = (curr_segments[w]->_region_id != fsr_ids[w]);
+          lengths[w] = curr_segments[w]->_length;
+          mask[w] = 1.0;
+        }
+        else {
+          curr_segments[w] = NULL;
+          lengths[w] = 0.0;
+          mask[w] = 0.0;
+        }
+      }
+
+      flushLaneScalarFluxes(fsr_ids, flush, lane_fsr_flux);
+
+      /* Gather the cross-sections and sources of each lane's FSR */
+      for (int w=0; w < VEC_LENGTH; w++) {
+
+        if (curr_segments[w] != NULL)
+          fsr_ids[w] = curr_segments[w]->_region_id;
+
+        FP_PRECISION* fsr_sigma_t = _FSR_materials[fsr_ids[w]]->getSigmaT();
+
+        for (int e=0; e < num_groups; e++) {
+          sigma_t[e*VEC_LENGTH+w] = fsr_sigma_t[e];
+          sources[e*VEC_LENGTH+w] = _reduced_source(fsr_ids[w],e);
+        }
+      }
+
+      computeLaneExponentials(lengths, sigma_t, taus, exponentials);
+
+      /* Tally the flux contribution of each lane's segment */
+      for (int p=0; p < _num_polar; p++) {
+        for (int e=0; e < num_groups; e++) {
+
+          FP_PRECISION* psi = &lane_flux[(p*num_groups+e)*VEC_LENGTH];
+          FP_PRECISION* exps = &exponentials[(p*num_groups+e)*VEC_LENGTH];
+          FP_PRECISION* fsr_flux = &lane_fsr_flux[e*VEC_LENGTH];
+          FP_PRECISION* source = &sources[e*VEC_LENGTH];
+          FP_PRECISION* weight = &weights[p*VEC_LENGTH];
+
+          VECTOR_LOOP
+          for (int w=0; w < VEC_LENGTH; w++) {
+            FP_PRECISION delta_psi = (psi[w] - source[w]) * exps[w] * mask[w];
+            fsr_flux[w] += delta_psi * weight[w];
+            psi[w] -= delta_psi;
+          }
+        }
+      }
+    }
+
+    /* Transfer the outgoing angular fluxes of each Track */
+    for (int w=0; w < num_lanes; w++) {
+      if (num_segments[w] > 0)
+        transferLaneBoundaryFlux(track_ids[w], w, d == 0, lane_flux, weights);
+    }
+  }
+
+  /* Flush the last FSR along each Track to the global scalar flux */
+  for (int w=0; w < VEC_LENGTH; w++)
+    flush[w] = (num_segments[w] > 0);
+
+  flushLaneScalarFluxes(fsr_ids, flush, lane_fsr_flux);
+
+  /* Record the work of this thread for the sweep report */
+  if (_sweep_report) {
+    _thread_busy_times[tid] += omp_get_wtime() - start_time;
+    _thread_num_segments[tid] += 2 * tot_segments;
+  }
+}
+
+
+/**
+ * @brief Computes the exponentials in the transport equation for the
+ *        segment of each vector lane for each energy group and polar angle.
+ * @details The exponentials are evaluated with the same method as by
+ *          VectorizedSolver::computeExponentials(...) with vectors across
+ *          the lanes.
+ * @param lengths the segment length of each lane
+ * @param sigma_t the total cross-section of each lane in each energy group
+ * @param taus a buffer for the optical length of each lane
+ * @param exponentials the array to store the exponentials of each lane
+ */
+void VectorizedSolver::computeLaneExponentials(FP_PRECISION* lengths,
+                                               FP_PRECISION* sigma_t,
+                                               FP_PRECISION* taus,
+                                               FP_PRECISION* exponentials) {
+
+  const int num_groups = _num_unpadded_groups;
+  FP_PRECISION* sinthetas = _quad->getSinThetas();
+
+  for (int p=0; p < _num_polar; p++) {
+    for (int e=0; e < num_groups; e++) {
+
+      FP_PRECISION* tau = &taus[(p*num_groups+e)*VEC_LENGTH];
+      FP_PRECISION* exps = &exponentials[(p*num_groups+e)*VEC_LENGTH];
+      FP_PRECISION* xs = &sigma_t[e*VEC_LENGTH];
+
+      /* Evaluate the exponentials using the linear interpolation table */
+      if (_interpolate_exponential) {
+        for (int w=0; w < VEC_LENGTH; w++) {
+          FP_PRECISION length = xs[w] * lengths[w];
+          int index = round_to_int(length * _inverse_exp_table_spacing);
+          index *= _two_times_num_polar;
+          exps[w] = (1. - (_exp_table[index+2 * p] * length +
+                           _exp_table[index + 2 * p +1]));
+        }
+      }
+
+      /* Evaluate the exponentials using the polynomial */
+      else if (_polynomial_exponential) {
+        VECTOR_LOOP
+        for (int w=0; w < VEC_LENGTH; w++)
+          exps[w] = exponential_poly(xs[w] * lengths[w] / sinthetas[p],
+                                     _exp_poly_coefficients,
+                                     _exp_poly_degree);
+      }
+
+      /* Initialize the tau argument for the exponential intrinsic */
+      else {
+        VECTOR_LOOP
+        for (int w=0; w < VEC_LENGTH; w++)
+          tau[w] = -xs[w] * lengths[w] / sinthetas[p];
+      }
+    }
+  }
+
+  if (_interpolate_exponential || _polynomial_exponential)
+    return;
+
+  /* Evaluate one minus the exponentials with the vector kernel */
+  int size = _num_polar * num_groups * VEC_LENGTH;
+  simd_exp(size, taus, exponentials);
+
+  VECTOR_LOOP
+  for (int i=0; i < size; i++)
+    exponentials[i] = 1.0 - exponentials[i];
+}
+
+
+/**
+ * @brief Flushes the FSR flux buffers of some vector lanes to the global
+ *        FSR scalar flux and zeroes the buffers.
+ * @details Lanes flushed to the same FSR are detected and combined first,
+ *          such that each FSR is updated once with the flux accumulation
+ *          scheme in use by CPUSolver::accumulateScalarFlux(...).
+ * @param fsr_ids the ID of the FSR tallied by each lane
+ * @param flush whether to flush each lane (reset for the combined lanes)
+ * @param lane_fsr_flux the FSR flux buffer of each lane
+ */
+void VectorizedSolver::flushLaneScalarFluxes(int* fsr_ids, bool* flush,
+                                             FP_PRECISION* lane_fsr_flux) {
+
+  const int num_groups = _num_unpadded_groups;
+  FP_PRECISION* fsr_flux = &_thread_fsr_flux(omp_get_thread_num());
+
+  for (int w=0; w < VEC_LENGTH; w++) {
+
+    if (!flush[w])
+      continue;
+
+    for (int e=0; e < num_groups; e++) {
+      fsr_flux[e] = lane_fsr_flux[e*VEC_LENGTH+w];
+      lane_fsr_flux[e*VEC_LENGTH+w] = 0.0;
+    }
+
+    /* Combine the later lanes tallying the same FSR */
+    for (int v=w+1; v < VEC_LENGTH; v++) {
+      if (flush[v] && fsr_ids[v] == fsr_ids[w]) {
+        for (int e=0; e < num_groups; e++) {
+          fsr_flux[e] += lane_fsr_flux[e*VEC_LENGTH+v];
+          lane_fsr_flux[e*VEC_LENGTH+v] = 0.0;
+        }
+        flush[v] = false;
+      }
+    }
+
+    accumulateScalarFlux(fsr_ids[w], fsr_flux);
+  }
+}
+
+
+/**
+ * @brief Updates the boundary flux for the Track in a vector lane given
+ *        boundary conditions.
+ * @param track_id the ID number for the Track of interest
+ * @param lane the vector lane of the Track
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @param lane_flux the outgoing angular fluxes of each lane
+ * @param lane_weights the polar weights of each lane
+ */
+void VectorizedSolver::transferLaneBoundaryFlux(int track_id, int lane,
+                                                bool direction,
+                                                FP_PRECISION* lane_flux,
+                                                FP_PRECISION* lane_weights) {
+  int start;
+  bool bc;
+  FP_PRECISION* track_leakage;
+  int track_out_id;
+
+  /* For the "forward" direction */
+  if (direction) {
+    start = _tracks[track_id]->isReflOut() * _polar_times_groups;
+    track_leakage = &_boundary_leakage(track_id,0);
+    track_out_id = _tracks[track_id]->getTrackOut()->getUid();
+    bc = _tracks[track_id]->getBCOut();
+  }
+
+  /* For the "reverse" direction */
+  else {
+    start = _tracks[track_id]->isReflIn() * _polar_times_groups;
+    track_leakage = &_boundary_leakage(track_id,_polar_times_groups);
+    track_out_id = _tracks[track_id]->getTrackIn()->getUid();
+    bc = _tracks[track_id]->getBCIn();
+  }
+
+  FP_PRECISION* track_out_flux = &_boundary_flux(track_out_id,0,0,start);
+
+  /* Loop over polar angles and energy groups */
+  for (int p=0; p < _num_polar; p++) {
+    for (int e=0; e < _num_unpadded_groups; e++) {
+      FP_PRECISION psi =
+           lane_flux[(p*_num_unpadded_groups+e)*VEC_LENGTH+lane];
+      track_out_flux(p,e) = psi * bc;
+      track_leakage(p,e) = psi * lane_weights[p*VEC_LENGTH+lane] * (!bc);
+    }
+  }
+}
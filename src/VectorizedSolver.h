@@ -14,27 +14,30 @@
 #include <math.h>
 #include <omp.h>
 #include <stdlib.h>
-#include <mkl.h>
 #include "CPUSolver.h"
+#include "simd.h"
 #endif
 
 /** Indexing scheme for the optical length (\f$ l\Sigma_t \f$) for a
  *  given Track segment for each polar angle and energy group */
 #define taus(p,e) (taus[(p)*_num_groups + (e)])
 
-/** Indexing scheme for the exponentials in the neutron transport equation
- *  (\f$ 1 - exp(-\frac{l\Sigma_t}{sin(\theta_p)}) \f$) for a given
- *  Track segment for each polar angle and energy group */
-#define exponentials(p,e) (exponentials[(p)*_num_groups + (e)])
+/** The largest number of energy groups for which the Tracks are swept in
+ *  bundles of VEC_LENGTH Tracks with one Track in each vector lane */
+#define TRACK_SIMD_MAX_GROUPS 2
 
 /**
  * @class VectorizedSolver VectorizedSolver.h "src/VectorizedSolver.h"
  * @brief This is a subclass of the CPUSolver class which uses memory-aligned
- *        data structures and Intel's auto-vectorization.
- * @note This class is only compiled if the Intel compiler is used when building
- *       OpenMOC. If building OpenMOC with the "--with-icpc" flag, then this
- *       class will be available in the "openmoc.intel.single" or
- *       "openmoc.intel.double" Python module.
+ *        data structures and SIMD vectorization.
+ * @details The loops over energy groups are vectorized by the compiler in
+ *          chunks of VEC_LENGTH groups, while the sums, scalings and
+ *          exponentials use the vector kernels in simd.h for the widest
+ *          instruction set supported by the processor at runtime. For up to
+ *          TRACK_SIMD_MAX_GROUPS energy groups, most of each vector would
+ *          hold padding, so the Tracks are instead swept in bundles of
+ *          VEC_LENGTH Tracks with the segments of each Track in one vector
+ *          lane.
  */
 class VectorizedSolver : public CPUSolver {
 
@@ -50,6 +53,22 @@ protected:
    *  each thread in each energy group and polar angle */
   FP_PRECISION* _thread_exponentials;
 
+  /** The number of energy groups before padding to a multiple of
+   *  VEC_LENGTH */
+  int _num_unpadded_groups;
+
+  /** Whether the Tracks may be swept in bundles with one Track in each
+   *  vector lane for small numbers of energy groups */
+  bool _track_parallel_sweep;
+
+  /** The number of values in the buffer of each thread for the angular
+   *  fluxes, cross-sections and exponentials of each vector lane */
+  int _lane_buffer_size;
+
+  /** A buffer for the angular fluxes, cross-sections and exponentials of
+   *  each vector lane for each thread */
+  FP_PRECISION* _thread_lane_buffers;
+
   void buildExpInterpTable();
   void initializeFluxArrays();
   void initializeSourceArrays();
@@ -58,11 +77,21 @@ protected:
   FP_PRECISION computeFSRSources();
   void scalarFluxTally(segment* curr_segment, int azim_index,
                        FP_PRECISION* track_flux,
-                       FP_PRECISION* fsr_flux, bool fwd);
+                       FP_PRECISION* fsr_flux);
   void transferBoundaryFlux(int track_id, int azim_index, bool direction,
                             FP_PRECISION* track_flux);
   void addSourceToScalarFlux();
   void computeKeff();
+  void transportSweep();
+  void sweepTrackBundle(int* track_ids, int num_lanes);
+  void computeLaneExponentials(FP_PRECISION* lengths, FP_PRECISION* sigma_t,
+                               FP_PRECISION* taus,
+                               FP_PRECISION* exponentials);
+  void flushLaneScalarFluxes(int* fsr_ids, bool* flush,
+                             FP_PRECISION* lane_fsr_flux);
+  void transferLaneBoundaryFlux(int track_id, int lane, bool direction,
+                                FP_PRECISION* lane_flux,
+                                FP_PRECISION* lane_weights);
 
 
   /**
@@ -83,8 +112,11 @@ public:
   virtual ~VectorizedSolver();
 
   int getNumVectorWidths();
+  bool isUsingTrackParallelSweep();
 
   void setGeometry(Geometry* geometry);
+  void setPersistentParallelRegion(bool persistent);
+  void setTrackParallelSweep(bool track_parallel);
 };
 
 
@@ -18,15 +18,14 @@
  * @struct dev_segment
  * @brief A dev_segment represents a line segment within a single flat source
  *        region along a track.
- * @details The dev_segment is intended for use on the GPU.
+ * @details The dev_segment is intended for use on the GPU and has the same
+ *          layout as the segment struct on the host. The Material for a
+ *          dev_segment is found from its flat source region.
  */
 struct dev_segment {
 
   /** The length of the segment (cm) */
-  FP_PRECISION _length;
-
-  /** A pointer to the Material in which this segment resides */
-  int _material_uid;
+  float _length;
 
   /** The ID for flat source region in which this segment resides */
   int _region_uid;
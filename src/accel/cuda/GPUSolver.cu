@@ -387,6 +387,7 @@ __device__ FP_PRECISION computeExponential(FP_PRECISION sigma_t,
  * @param curr_segment a pointer to the Track segment of interest
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param energy_group the energy group of interest
+ * @param FSR_materials an array of FSR Material UIDs
  * @param materials the array of dev_material pointers
  * @param track_flux a pointer to the Track's angular flux
  * @param reduced_source the array of FSR sources / total xs
@@ -397,6 +398,7 @@ __device__ FP_PRECISION computeExponential(FP_PRECISION sigma_t,
 __device__ void scalarFluxTally(dev_segment* curr_segment,
                                 int azim_index,
                                 int energy_group,
+                                int* FSR_materials,
                                 dev_material* materials,
                                 FP_PRECISION* track_flux,
                                 FP_PRECISION* reduced_source,
@@ -406,7 +408,7 @@ __device__ void scalarFluxTally(dev_segment* curr_segment,
 
   int fsr_id = curr_segment->_region_uid;
   FP_PRECISION length = curr_segment->_length;
-  dev_material* curr_material = &materials[curr_segment->_material_uid];
+  dev_material* curr_material = &materials[FSR_materials[fsr_id]];
   FP_PRECISION *sigma_t = curr_material->_sigma_t;
 
   /* The change in angular flux long this Track segment in this FSR */
@@ -500,6 +502,7 @@ __device__ void transferBoundaryFlux(dev_track* curr_track,
  * @param boundary_flux an array of Track boundary fluxes
  * @param reduced_source an array of FSR sources / total xs
  * @param leakage an array of angular flux leakaages
+ * @param FSR_materials an array of FSR Material UIDs
  * @param materials an array of dev_material pointers
  * @param tracks an array of Tracks
  * @param _exp_table an array for the exponential interpolation table
@@ -511,6 +514,7 @@ __global__ void transportSweepOnDevice(FP_PRECISION* scalar_flux,
                                        FP_PRECISION* boundary_flux,
                                        FP_PRECISION* reduced_source,
                                        FP_PRECISION* leakage,
+                                       int* FSR_materials,
                                        dev_material* materials,
                                        dev_track* tracks,
                                        FP_PRECISION* _exp_table,
@@ -557,7 +561,8 @@ __global__ void transportSweepOnDevice(FP_PRECISION* scalar_flux,
     /* Loop over each Track segment in forward direction */
     for (int i=0; i < num_segments; i++) {
       curr_segment = &curr_track->_segments[i];
-      scalarFluxTally(curr_segment, azim_index, energy_group, materials,
+      scalarFluxTally(curr_segment, azim_index, energy_group,
+                      FSR_materials, materials,
                       track_flux, reduced_source, polar_weights,
                       _exp_table, scalar_flux);
     }
@@ -572,7 +577,8 @@ __global__ void transportSweepOnDevice(FP_PRECISION* scalar_flux,
 
     for (int i=num_segments-1; i > -1; i--) {
       curr_segment = &curr_track->_segments[i];
-      scalarFluxTally(curr_segment, azim_index, energy_group, materials,
+      scalarFluxTally(curr_segment, azim_index, energy_group,
+                      FSR_materials, materials,
                       track_flux, reduced_source, polar_weights,
                       _exp_table, scalar_flux);
   }
@@ -840,7 +846,8 @@ FP_PRECISION GPUSolver::getFSRScalarFlux(int fsr_id, int energy_group) {
 
   /* Copy the scalar flux for this FSR and energy group from the device */
   FP_PRECISION fsr_scalar_flux;
-  int flux_index = fsr_id * _num_groups + (energy_group - 1);
+  int flux_index = _geometry->getInternalFSRId(fsr_id) * _num_groups +
+                   (energy_group - 1);
   cudaMemcpy((void*)&fsr_scalar_flux, (void*)&_scalar_flux[flux_index],
              sizeof(FP_PRECISION), cudaMemcpyDeviceToHost);
 
@@ -899,7 +906,8 @@ FP_PRECISION GPUSolver::getFSRSource(int fsr_id, int energy_group) {
 
   /* Copy the source for this FSR and energy group from the device */
   FP_PRECISION fsr_source;
-  int flux_index = fsr_id * _num_groups + (energy_group - 1);
+  int flux_index = _geometry->getInternalFSRId(fsr_id) * _num_groups +
+                   (energy_group - 1);
   cudaMemcpy((void*)&fsr_source, (void*)&_source[flux_index],
              sizeof(FP_PRECISION), cudaMemcpyDeviceToHost);
 
@@ -1056,8 +1064,13 @@ void GPUSolver::initializeFSRs() {
     /* Create a temporary FSR array to populate and then copy to device */
     FP_PRECISION* temp_FSR_volumes = new FP_PRECISION[_num_FSRs];
 
-    /* Get the array indexed by FSR IDs with Material ID values */
+    /* Get the array indexed by FSR IDs with Material ID values and order
+     * it by the internal FSR IDs used for the device arrays */
     int* FSRs_to_materials = _geometry->getFSRtoMaterialMap();
+    int* temp_FSR_materials = new int[_num_FSRs];
+
+    for (int r=0; r < _num_FSRs; r++)
+      temp_FSR_materials[r] = FSRs_to_materials[_geometry->getFSRId(r)];
 
     /* Initialize each FSRs volume to 0 to avoid NaNs */
     memset(temp_FSR_volumes, FP_PRECISION(0.), _num_FSRs*sizeof(FP_PRECISION));
@@ -1091,7 +1104,7 @@ void GPUSolver::initializeFSRs() {
     /* Copy the temporary array of FSRs to the device */
     cudaMemcpy((void*)_FSR_volumes, (void*)temp_FSR_volumes,
       _num_FSRs * sizeof(FP_PRECISION), cudaMemcpyHostToDevice);
-    cudaMemcpy((void*)_FSR_materials, (void*)FSRs_to_materials,
+    cudaMemcpy((void*)_FSR_materials, (void*)temp_FSR_materials,
       _num_FSRs * sizeof(int), cudaMemcpyHostToDevice);
 
     /* Copy the number of FSRs into constant memory on the GPU */
@@ -1100,6 +1113,7 @@ void GPUSolver::initializeFSRs() {
 
     /* Free the temporary array of FSRs on the host */
     free(temp_FSR_volumes);
+    delete [] temp_FSR_materials;
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the GPUSolver's FSRs "
@@ -1140,6 +1154,27 @@ void GPUSolver::initializeMaterials() {
 }
 
 
+/**
+ * @brief Copies the cross-sections of some Materials to the GPU and refreshes
+ *        the exponential interpolation table after they have changed.
+ * @param materials the Materials whose cross-sections have changed
+ */
+void GPUSolver::updateMaterials(std::vector<Material*>& materials) {
+
+  log_printf(INFO, "Updating materials on the GPU...");
+
+  /* Rebuild the exponential table if it no longer spans every segment */
+  FP_PRECISION table_length =
+       (_exp_table_size / _two_times_num_polar) * _exp_table_spacing;
+
+  if (_track_generator->getMaxOpticalLength() > table_length)
+    buildExpInterpTable();
+
+  for (size_t i=0; i < materials.size(); i++)
+    update_material_on_gpu(materials[i], &_materials[materials[i]->getUid()]);
+}
+
+
 /**
  * @brief Allocates memory on the GPU for all Tracks in the simulation.
  */
@@ -1385,10 +1420,18 @@ void GPUSolver::buildExpInterpTable(){
                      _num_polar * sizeof(FP_PRECISION), 0,
                      cudaMemcpyHostToDevice);
 
-  /* Set size of interpolation table */
-  int num_array_values =
-          10 * sqrt(1. / (8. * _source_convergence_thresh * 1e-2));
-  _exp_table_spacing = 10. / num_array_values;
+  /* The polynomial is not implemented on the device */
+  if (_polynomial_exponential)
+    log_printf(WARNING, "The GPUSolver will use the exp intrinsic rather "
+               "than a polynomial to evaluate exponentials");
+
+  /* Set size of interpolation table to span the optical length of every
+   * segment, which may exceed the default range if segments are not split */
+  FP_PRECISION max_optical_length = std::max(FP_PRECISION(MAX_OPTICAL_LENGTH),
+                                 _track_generator->getMaxOpticalLength());
+  int num_array_values = max_optical_length *
+          sqrt(1. / (8. * _source_convergence_thresh * 1e-2));
+  _exp_table_spacing = max_optical_length / num_array_values;
   _inverse_exp_table_spacing = 1.0 / _exp_table_spacing;
   _exp_table_size = _two_times_num_polar * num_array_values;
   _exp_table_max_index = _exp_table_size - _two_times_num_polar - 1;
@@ -1412,6 +1455,9 @@ void GPUSolver::buildExpInterpTable(){
   }
 
   /* Allocate memory for the interpolation table on the device */
+  if (_exp_table != NULL)
+    cudaFree(_exp_table);
+
   cudaMalloc((void**)&_exp_table, _exp_table_size * sizeof(FP_PRECISION));
 
   /* Copy exponential interpolation table to the device */
@@ -1553,7 +1599,8 @@ void GPUSolver::transportSweep() {
 
   transportSweepOnDevice<<<_B, _T, shared_mem>>>(_scalar_flux, _boundary_flux,
                                                  _reduced_source, _leakage,
-                                                 _materials, _dev_tracks,
+                                                 _FSR_materials, _materials,
+                                                 _dev_tracks,
                                                  _exp_table,
                                                  tid_offset, tid_max);
 
@@ -1563,7 +1610,8 @@ void GPUSolver::transportSweep() {
 
   transportSweepOnDevice<<<_B, _T, shared_mem>>>(_scalar_flux, _boundary_flux,
                                                  _reduced_source, _leakage,
-                                                 _materials, _dev_tracks,
+                                                 _FSR_materials, _materials,
+                                                 _dev_tracks,
                                                  _exp_table,
                                                  tid_offset, tid_max);
 }
@@ -1629,6 +1677,56 @@ void GPUSolver::computeKeff() {
 }
 
 
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint from the device
+ *        to a buffer on the host.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values to
+ */
+void GPUSolver::getCheckpointArray(checkpointArray array, long offset,
+                                   long length, FP_PRECISION* values) {
+
+  FP_PRECISION* data;
+
+  if (array == CHECKPOINT_SCALAR_FLUX)
+    data = _scalar_flux;
+  else if (array == CHECKPOINT_OLD_SOURCE)
+    data = _old_source;
+  else
+    data = _boundary_flux;
+
+  cudaMemcpy((void*)values, (void*)&data[offset],
+             length * sizeof(FP_PRECISION), cudaMemcpyDeviceToHost);
+}
+
+
+/**
+ * @brief Copies a chunk of an array stored in a checkpoint from a buffer
+ *        on the host to the device.
+ * @param array the checkpoint array
+ * @param offset the index of the first value to copy
+ * @param length the number of values to copy
+ * @param values the buffer to copy the values from
+ */
+void GPUSolver::setCheckpointArray(checkpointArray array, long offset,
+                                   long length, FP_PRECISION* values) {
+
+  FP_PRECISION* data;
+
+  if (array == CHECKPOINT_SCALAR_FLUX)
+    data = _scalar_flux;
+  else if (array == CHECKPOINT_OLD_SOURCE)
+    data = _old_source;
+  else
+    data = _boundary_flux;
+
+  cudaMemcpy((void*)&data[offset], (void*)values,
+             length * sizeof(FP_PRECISION), cudaMemcpyHostToDevice);
+}
+
+
 /**
  * @brief Computes the volume-weighted, energy integrated fission rate in
  *        each FSR and stores them in an array indexed by FSR ID.
@@ -1660,9 +1758,16 @@ void GPUSolver::computeFSRFissionRates(double* fission_rates, int num_FSRs) {
                                            _scalar_flux);
 
   /* Copy the fission rate array from the device to the host */
-  cudaMemcpy((void*)fission_rates, (void*)dev_fission_rates,
+  double* temp_fission_rates = new double[_num_FSRs];
+  cudaMemcpy((void*)temp_fission_rates, (void*)dev_fission_rates,
              _num_FSRs * sizeof(double), cudaMemcpyDeviceToHost);
 
+  /* Order the fission rates by FSR ID rather than by internal FSR ID */
+  for (int r=0; r < _num_FSRs; r++)
+    fission_rates[_geometry->getFSRId(r)] = temp_fission_rates[r];
+
+  delete [] temp_fission_rates;
+
   /* Deallocate the memory assigned to store the fission rates on the device */
   cudaFree(dev_fission_rates);
 
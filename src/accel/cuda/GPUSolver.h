@@ -108,6 +108,7 @@ private:
   void initializePolarQuadrature();
   void initializeFSRs();
   void initializeMaterials();
+  void updateMaterials(std::vector<Material*>& materials);
   void initializeTracks();
   void initializeFluxArrays();
   void initializeSourceArrays();
@@ -122,6 +123,10 @@ private:
   void addSourceToScalarFlux();
   void computeKeff();
   void transportSweep();
+  void getCheckpointArray(checkpointArray array, long offset, long length,
+                          FP_PRECISION* values);
+  void setCheckpointArray(checkpointArray array, long offset, long length,
+                          FP_PRECISION* values);
 
 public:
 
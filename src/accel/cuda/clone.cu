@@ -70,6 +70,42 @@ void clone_material_on_gpu(Material* material_h, dev_material* material_d) {
 }
 
 
+/**
+ * @brief Given a pointer to a Material on the host and a dev_material on the
+ *        GPU cloned from it, copy the Material's cross-sections to the
+ *        dev_material's existing data arrays.
+ * @details This routine is called by the GPUSolver::updateMaterials(...)
+ *          private class method and is not intended to be called directly.
+ * @param material_h pointer to a Material on the host
+ * @param material_d pointer to a dev_material on the GPU
+ */
+void update_material_on_gpu(Material* material_h, dev_material* material_d) {
+
+  int num_groups = material_h->getNumEnergyGroups();
+
+  /* Copy the dev_material to the host for its data array pointers */
+  dev_material material;
+  cudaMemcpy((void*)&material, (void*)material_d, sizeof(dev_material),
+             cudaMemcpyDeviceToHost);
+
+  /* Copy Material data from host to arrays on the device */
+  cudaMemcpy((void*)material._sigma_t, (void*)material_h->getSigmaT(),
+             num_groups * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy((void*)material._sigma_a, (void*)material_h->getSigmaA(),
+             num_groups * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy((void*)material._sigma_s, (void*)material_h->getSigmaS(),
+             num_groups * num_groups * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy((void*)material._sigma_f, (void*)material_h->getSigmaF(),
+             num_groups * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy((void*)material._nu_sigma_f, (void*)material_h->getNuSigmaF(),
+             num_groups * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy((void*)material._chi, (void*)material_h->getChi(),
+             num_groups * sizeof(double), cudaMemcpyHostToDevice);
+
+  return;
+}
+
+
 /**
  * @brief Given a pointer to a Track on the host and a dev_track on
  *        the GPU, copy all of the class attributes and segments from
@@ -82,7 +118,6 @@ void clone_material_on_gpu(Material* material_h, dev_material* material_d) {
 void clone_track_on_gpu(Track* track_h, dev_track* track_d) {
 
   dev_segment* dev_segments;
-  dev_segment* host_segments = new dev_segment[track_h->getNumSegments()];
   dev_track new_track;
 
   new_track._uid = track_h->getUid();
@@ -97,20 +132,12 @@ void clone_track_on_gpu(Track* track_h, dev_track* track_d) {
              track_h->getNumSegments() * sizeof(dev_segment));
   new_track._segments = dev_segments;
 
-  for (int s=0; s < track_h->getNumSegments(); s++) {
-    segment* curr = track_h->getSegment(s);
-    host_segments[s]._length = curr->_length;
-    host_segments[s]._region_uid = curr->_region_id;
-    host_segments[s]._material_uid = curr->_material->getUid();
-  }
-
-  cudaMemcpy((void*)dev_segments, (void*)host_segments,
+  /* The host segments have the same layout as the dev_segments */
+  cudaMemcpy((void*)dev_segments, (void*)track_h->getSegments(),
              track_h->getNumSegments() * sizeof(dev_segment),
              cudaMemcpyHostToDevice);
   cudaMemcpy((void*)track_d, (void*)&new_track, sizeof(dev_track),
              cudaMemcpyHostToDevice);
 
-  delete [] host_segments;
-
   return;
 }
@@ -10,4 +10,5 @@
 #include "../DeviceTrack.h"
 
 void clone_material_on_gpu(Material* material_h, dev_material* material_d);
+void update_material_on_gpu(Material* material_h, dev_material* material_d);
 void clone_track_on_gpu(Track* track_h, dev_track* track_d);
@@ -0,0 +1,149 @@
+/**
+ * @file exponential.h
+ * @brief Utility functions for the vectorizable evaluation of the
+ *        exponential in the neutron transport equation.
+ * @date October 17, 2026
+ */
+
+#ifndef EXPONENTIAL_H_
+#define EXPONENTIAL_H_
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+
+/** The maximum polynomial degree for the exponential approximation */
+#define MAX_EXP_POLY_DEGREE 13
+
+/** The natural logarithm of 2 */
+#define LN_2 0.693147180559945309
+
+/** The base 2 logarithm of e */
+#define LOG2_E 1.44269504088896341
+
+
+/**
+ * @brief Computes the degree of the polynomial needed to approximate
+ *        \f$ 2^{-f} \f$ for \f$ f \in [-1/2, 1/2] \f$ within an error.
+ * @details The error of a Taylor polynomial of degree d for the exponential
+ *          of \f$ y = -f ln(2) \f$ is bounded by
+ *          \f$ \sqrt{2} |y|^{d+1} / (d+1)! \f$ with \f$ |y| \le ln(2) / 2 \f$.
+ * @param max_error the maximum error for the exponential
+ * @return the polynomial degree
+ */
+inline int exponential_poly_degree(double max_error) {
+
+  double y = LN_2 / 2.;
+  double error = sqrt(2.) * y;
+  int degree = 0;
+
+  while (error > max_error && degree < MAX_EXP_POLY_DEGREE) {
+    degree++;
+    error *= y / (degree + 1);
+  }
+
+  return degree;
+}
+
+
+/**
+ * @brief Computes the Taylor polynomial coefficients for the exponential.
+ * @param coefficients an array of length degree+1 for the coefficients
+ * @param degree the polynomial degree
+ */
+template <typename T>
+inline void exponential_poly_coefficients(T* coefficients, int degree) {
+
+  double coefficient = 1.;
+
+  for (int k=0; k <= degree; k++) {
+    coefficients[k] = coefficient;
+    coefficient /= (k + 1);
+  }
+}
+
+
+/**
+ * @brief Computes the integer power of 2 for an exponent between the
+ *        smallest and largest normalized exponent by constructing the bits
+ *        of a floating point number.
+ * @param n the exponent
+ * @return \f$ 2^n \f$
+ */
+inline double exponential_pow2(double n) {
+  int64_t bits = (int64_t)(n + 1023.) << 52;
+  double value;
+  memcpy(&value, &bits, sizeof(double));
+  return value;
+}
+
+
+/**
+ * @brief Computes the integer power of 2 for an exponent between the
+ *        smallest and largest normalized exponent by constructing the bits
+ *        of a floating point number.
+ * @param n the exponent
+ * @return \f$ 2^n \f$
+ */
+inline float exponential_pow2(float n) {
+  int32_t bits = (int32_t)(n + 127.f) << 23;
+  float value;
+  memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+
+/**
+ * @brief Evaluates \f$ exp(-x) \f$ for any \f$ x \ge 0 \f$ with a
+ *        polynomial approximation.
+ * @details The argument is reduced with \f$ exp(-x) = 2^{-n} 2^{-f} \f$
+ *          where n is the integer nearest to \f$ x log_2(e) \f$. The
+ *          exponential \f$ 2^{-f} = exp(-f ln(2)) \f$ is approximated by
+ *          a polynomial and \f$ 2^{-n} \f$ is constructed exactly. Since
+ *          there are no branches or table lookups, a loop of calls to this
+ *          function may be vectorized by the compiler. Exponentials smaller
+ *          than the smallest normalized floating point number are flushed
+ *          to zero.
+ * @param x the argument of the exponential
+ * @param coefficients the polynomial coefficients
+ * @param degree the polynomial degree
+ * @return \f$ exp(-x) \f$
+ */
+template <typename T>
+inline T exponential_poly_neg(T x, const T* coefficients, int degree) {
+
+  /* The largest argument for which exp(-x) is a normalized number */
+  const T max_x = (sizeof(T) == sizeof(float)) ? T(87.) : T(708.);
+
+  x = (x < max_x) ? x : max_x;
+
+  T t = x * T(LOG2_E);
+  T n = floor(t + T(0.5));
+  T y = (n - t) * T(LN_2);
+
+  /* Evaluate the polynomial with Horner's method */
+  T poly = coefficients[degree];
+  for (int k=degree-1; k >= 0; k--)
+    poly = poly * y + coefficients[k];
+
+  T expon = poly * exponential_pow2(-n);
+  return (x < max_x) ? expon : T(0.);
+}
+
+
+/**
+ * @brief Evaluates \f$ 1 - exp(-x) \f$ for any \f$ x \ge 0 \f$ with a
+ *        polynomial approximation.
+ * @details The exponential is evaluated by exponential_poly_neg(...).
+ * @param x the argument of the exponential
+ * @param coefficients the polynomial coefficients
+ * @param degree the polynomial degree
+ * @return \f$ 1 - exp(-x) \f$
+ */
+template <typename T>
+inline T exponential_poly(T x, const T* coefficients, int degree) {
+  return T(1.) - exponential_poly_neg(x, coefficients, degree);
+}
+
+
+#endif /* EXPONENTIAL_H_ */
@@ -0,0 +1,476 @@
+#include "numa.h"
+#include <new>
+
+#ifdef __linux__
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <vector>
+#define NUMA_LINUX
+
+#ifndef MAP_HUGETLB
+#define MAP_HUGETLB 0x40000
+#endif
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+#ifndef MADV_HUGEPAGE
+#define MADV_HUGEPAGE 14
+#endif
+#endif
+
+
+/** The Linux memory policy which interleaves pages across NUMA nodes */
+#define NUMA_MPOL_INTERLEAVE 3
+
+/** The number of pages whose NUMA nodes are queried at once */
+#define NUMA_PAGE_CHUNK 1024
+
+
+/**
+ * @struct hugePageHeader
+ * @brief The header preceding each array allocated by huge_page_malloc(...).
+ */
+struct hugePageHeader {
+
+  /** The memory mapping holding the array (NULL if the array was allocated
+   *  with posix_memalign(...)) */
+  void* mapping;
+
+  /** The size of the memory mapping (bytes) */
+  size_t mapping_size;
+};
+
+
+/** The file descriptor of each thread's counter of data TLB misses (-1 if
+ *  the counter is unavailable, -2 if it is not open) */
+static int tlb_miss_counter = -2;
+#pragma omp threadprivate(tlb_miss_counter)
+
+
+/**
+ * @brief Returns the number of NUMA nodes of the machine.
+ * @return the number of NUMA nodes (1 if it cannot be determined)
+ */
+int get_num_numa_nodes() {
+
+  int num_nodes = 0;
+
+#ifdef NUMA_LINUX
+  char path[64];
+
+  while (num_nodes < MAX_NUMA_NODES) {
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d",
+             num_nodes);
+
+    if (access(path, F_OK) != 0)
+      break;
+
+    num_nodes++;
+  }
+#endif
+
+  return (num_nodes > 0) ? num_nodes : 1;
+}
+
+
+/**
+ * @brief Returns the NUMA node of a CPU.
+ * @param cpu the ID of the CPU
+ * @return the NUMA node of the CPU (0 if it cannot be determined)
+ */
+int get_numa_node_of_cpu(int cpu) {
+
+#ifdef NUMA_LINUX
+  char path[64];
+  int num_nodes = get_num_numa_nodes();
+
+  for (int n=0; n < num_nodes; n++) {
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/node%d",
+             cpu, n);
+
+    if (access(path, F_OK) == 0)
+      return n;
+  }
+#endif
+
+  return 0;
+}
+
+
+/**
+ * @brief Pins each thread of the OpenMP team to a core.
+ * @details The cores are those which the process was allowed to run on
+ *          when the threads were first pinned. For AFFINITY_COMPACT, the
+ *          threads fill the cores of each NUMA node in turn, while for
+ *          AFFINITY_SCATTER, consecutive threads alternate between the NUMA
+ *          nodes. For AFFINITY_NONE, the threads are allowed to run on any
+ *          of the cores again. This must be called outside of a parallel
+ *          region, and the threads remain pinned for later parallel regions
+ *          with the same number of threads.
+ * @param affinity the pinning of the threads to cores
+ */
+void pin_openmp_threads(threadAffinity affinity) {
+
+#ifdef NUMA_LINUX
+
+  /* The cores which the process was allowed to run on before pinning */
+  static cpu_set_t process_cpus;
+  static bool saved_process_cpus = false;
+
+  if (!saved_process_cpus) {
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &process_cpus) != 0) {
+      log_printf(WARNING, "Unable to pin the threads since the cores "
+                 "available to the process could not be determined");
+      return;
+    }
+
+    saved_process_cpus = true;
+  }
+
+  /* Sort the available cores by NUMA node */
+  int num_nodes = get_num_numa_nodes();
+  std::vector< std::vector<int> > node_cpus(num_nodes);
+
+  for (int cpu=0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &process_cpus))
+      node_cpus[get_numa_node_of_cpu(cpu)].push_back(cpu);
+  }
+
+  /* Order the cores for consecutive threads */
+  std::vector<int> cpus;
+
+  if (affinity == AFFINITY_SCATTER) {
+    for (size_t i=0; cpus.size() < (size_t)CPU_COUNT(&process_cpus); i++) {
+      for (int n=0; n < num_nodes; n++) {
+        if (i < node_cpus[n].size())
+          cpus.push_back(node_cpus[n][i]);
+      }
+    }
+  }
+  else {
+    for (int n=0; n < num_nodes; n++)
+      cpus.insert(cpus.end(), node_cpus[n].begin(), node_cpus[n].end());
+  }
+
+  int num_failed = 0;
+
+  #pragma omp parallel reduction(+:num_failed)
+  {
+    cpu_set_t thread_cpus = process_cpus;
+
+    if (affinity != AFFINITY_NONE) {
+      CPU_ZERO(&thread_cpus);
+      CPU_SET(cpus[omp_get_thread_num() % cpus.size()], &thread_cpus);
+    }
+
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &thread_cpus) != 0)
+      num_failed++;
+  }
+
+  if (num_failed > 0)
+    log_printf(WARNING, "Unable to pin %d of the OpenMP threads to cores",
+               num_failed);
+
+#else
+
+  if (affinity != AFFINITY_NONE)
+    log_printf(WARNING, "Unable to pin the OpenMP threads to cores on this "
+               "operating system");
+
+#endif
+}
+
+
+/**
+ * @brief Requests that the pages of an array be interleaved across all
+ *        NUMA nodes.
+ * @details Only the pages which lie entirely within the array are
+ *          interleaved, and only once they are first touched, such that
+ *          this should be called before the array is initialized.
+ * @param ptr a pointer to the array
+ * @param size the size of the array (bytes)
+ * @return whether the pages will be interleaved
+ */
+bool interleave_pages(void* ptr, size_t size) {
+
+#ifdef NUMA_LINUX
+  int num_nodes = get_num_numa_nodes();
+
+  if (num_nodes < 2)
+    return false;
+
+  const int bits = 8 * sizeof(unsigned long);
+  unsigned long node_mask[MAX_NUMA_NODES / bits + 1];
+  memset(node_mask, 0, sizeof(node_mask));
+
+  for (int n=0; n < num_nodes; n++)
+    node_mask[n / bits] |= 1UL << (n % bits);
+
+  uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t start = ((uintptr_t)ptr + page_size - 1) & ~(page_size - 1);
+  uintptr_t end = ((uintptr_t)ptr + size) & ~(page_size - 1);
+
+  if (end <= start)
+    return false;
+
+  return syscall(SYS_mbind, start, end - start, NUMA_MPOL_INTERLEAVE,
+                 node_mask, MAX_NUMA_NODES + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+
+/**
+ * @brief Counts the pages of an array on each NUMA node.
+ * @details Pages which have not yet been touched are not counted.
+ * @param ptr a pointer to the array
+ * @param size the size of the array (bytes)
+ * @param num_node_pages an array of length MAX_NUMA_NODES to store the
+ *        number of pages on each NUMA node
+ * @return whether the NUMA nodes of the pages could be determined
+ */
+bool count_numa_pages(void* ptr, size_t size, long* num_node_pages) {
+
+  memset(num_node_pages, 0, MAX_NUMA_NODES * sizeof(long));
+
+#ifdef NUMA_LINUX
+  uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t start = (uintptr_t)ptr & ~(page_size - 1);
+  uintptr_t end = (uintptr_t)ptr + size;
+
+  void* pages[NUMA_PAGE_CHUNK];
+  int status[NUMA_PAGE_CHUNK];
+
+  while (start < end) {
+
+    int num_pages = 0;
+
+    while (num_pages < NUMA_PAGE_CHUNK && start < end) {
+      pages[num_pages++] = (void*)start;
+      start += page_size;
+    }
+
+    /* Query the nodes of the pages without moving them */
+    if (syscall(SYS_move_pages, 0, num_pages, pages, NULL, status, 0) != 0)
+      return false;
+
+    for (int i=0; i < num_pages; i++) {
+      if (status[i] >= 0 && status[i] < MAX_NUMA_NODES)
+        num_node_pages[status[i]]++;
+    }
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+/**
+ * @brief Allocates an array backed by huge pages.
+ * @details Reserved 2 MB or 1 GB huge pages are mapped if requested. If
+ *          none are available, normal pages aligned to 2 MB are mapped
+ *          instead, and the operating system is advised to back them with
+ *          transparent huge pages. If no memory can be mapped, or for
+ *          NO_HUGE_PAGES, the array is allocated with posix_memalign(...).
+ *          The pages of a mapping are placed on NUMA nodes when they are
+ *          first touched. The array is aligned to HUGE_PAGE_ALIGNMENT bytes
+ *          and must be freed with huge_page_free(...).
+ * @param size the size of the array (bytes)
+ * @param huge_pages the pages to back the array with
+ * @return a pointer to the array
+ */
+void* huge_page_malloc(size_t size, hugePageType huge_pages) {
+
+  size_t total_size = size + HUGE_PAGE_ALIGNMENT;
+  void* mapping = NULL;
+  size_t mapping_size = 0;
+
+#ifdef NUMA_LINUX
+
+  /* Map reserved huge pages, which fails if too few have been reserved */
+  if (huge_pages == HUGE_PAGES_2MB || huge_pages == HUGE_PAGES_1GB) {
+
+    long page_size = HUGE_PAGE_SIZE_2MB;
+    int page_shift = 21;
+
+    if (huge_pages == HUGE_PAGES_1GB) {
+      page_size = HUGE_PAGE_SIZE_1GB;
+      page_shift = 30;
+    }
+
+    mapping_size = (total_size + page_size - 1) / page_size * page_size;
+    mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                   (page_shift << MAP_HUGE_SHIFT), -1, 0);
+
+    if (mapping == MAP_FAILED) {
+      log_printf(INFO, "Unable to map %1.2f MB of reserved %s huge pages, "
+                 "so transparent huge pages are requested instead",
+                 mapping_size / 1.E6, (page_shift == 30) ? "1 GB" : "2 MB");
+      mapping = NULL;
+      huge_pages = TRANSPARENT_HUGE_PAGES;
+    }
+  }
+
+  /* Map normal pages starting on a 2 MB boundary such that they may be
+   * merged into transparent huge pages */
+  if (huge_pages == TRANSPARENT_HUGE_PAGES) {
+
+    long page_size = HUGE_PAGE_SIZE_2MB;
+    mapping_size = (total_size + page_size - 1) / page_size * page_size;
+    void* ptr = mmap(NULL, mapping_size + page_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (ptr != MAP_FAILED) {
+
+      /* Unmap the pages before the boundary and after the array */
+      uintptr_t start = (uintptr_t)ptr;
+      uintptr_t aligned_start = (start + page_size - 1) & ~(page_size - 1);
+
+      if (aligned_start > start)
+        munmap(ptr, aligned_start - start);
+
+      munmap((void*)(aligned_start + mapping_size),
+             start + page_size - aligned_start);
+
+      mapping = (void*)aligned_start;
+
+      if (madvise(mapping, mapping_size, MADV_HUGEPAGE) != 0)
+        log_printf(DEBUG, "Transparent huge pages are unavailable");
+    }
+  }
+
+#endif
+
+  /* Allocate normal pages if no memory has been mapped */
+  void* ptr = mapping;
+
+  if (mapping == NULL) {
+    if (posix_memalign(&ptr, HUGE_PAGE_ALIGNMENT, total_size) != 0)
+      throw std::bad_alloc();
+  }
+
+  hugePageHeader* header = (hugePageHeader*)ptr;
+  header->mapping = mapping;
+  header->mapping_size = mapping_size;
+
+  return (char*)ptr + HUGE_PAGE_ALIGNMENT;
+}
+
+
+/**
+ * @brief Frees an array allocated by huge_page_malloc(...).
+ * @param ptr a pointer to the array
+ */
+void huge_page_free(void* ptr) {
+
+  if (ptr == NULL)
+    return;
+
+  hugePageHeader* header = (hugePageHeader*)((char*)ptr -
+                                             HUGE_PAGE_ALIGNMENT);
+
+#ifdef NUMA_LINUX
+  if (header->mapping != NULL) {
+    munmap(header->mapping, header->mapping_size);
+    return;
+  }
+#endif
+
+  free(header);
+}
+
+
+/**
+ * @brief Starts counting the data TLB misses of each thread of the OpenMP
+ *        team.
+ * @details A hardware counter is opened for each thread, and is closed by
+ *          stop_tlb_miss_count(). This requires that the operating system
+ *          gives users access to the hardware counters (see
+ *          /proc/sys/kernel/perf_event_paranoid), and must be called outside
+ *          of a parallel region.
+ */
+void start_tlb_miss_count() {
+
+#ifdef NUMA_LINUX
+  #pragma omp parallel
+  {
+    if (tlb_miss_counter == -2) {
+
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.size = sizeof(attr);
+      attr.config = PERF_COUNT_HW_CACHE_DTLB |
+           (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+      /* Count the misses of the calling thread on any CPU */
+      tlb_miss_counter = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+      if (tlb_miss_counter < 0)
+        tlb_miss_counter = -1;
+    }
+
+    if (tlb_miss_counter >= 0) {
+      ioctl(tlb_miss_counter, PERF_EVENT_IOC_RESET, 0);
+      ioctl(tlb_miss_counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+
+/**
+ * @brief Stops counting the data TLB misses of each thread of the OpenMP
+ *        team.
+ * @details This must be called outside of a parallel region by the same
+ *          team of threads which called start_tlb_miss_count(), and closes
+ *          the counter of each thread.
+ * @return the total number of data TLB misses of the threads (-1 if they
+ *         could not be counted for every thread)
+ */
+long stop_tlb_miss_count() {
+
+  long num_misses = 0;
+  int num_uncounted = 0;
+
+#ifdef NUMA_LINUX
+  #pragma omp parallel reduction(+:num_misses,num_uncounted)
+  {
+    long long count = 0;
+
+    if (tlb_miss_counter < 0)
+      num_uncounted++;
+    else {
+      ioctl(tlb_miss_counter, PERF_EVENT_IOC_DISABLE, 0);
+
+      if (read(tlb_miss_counter, &count, sizeof(count)) != sizeof(count))
+        num_uncounted++;
+
+      num_misses += count;
+
+      close(tlb_miss_counter);
+      tlb_miss_counter = -2;
+    }
+  }
+#else
+  num_uncounted = 1;
+#endif
+
+  return (num_uncounted == 0) ? num_misses : -1;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file numa.h
+ * @brief Utility functions for placing threads and memory pages on the
+ *        NUMA nodes of a shared memory machine, backing arrays with huge
+ *        pages and counting TLB misses.
+ * @details The threads are pinned, the pages are placed and the TLB misses
+ *          are counted with Linux system calls, such that no NUMA or
+ *          performance counter library is needed. On other operating
+ *          systems, the threads are not pinned, the pages are placed by the
+ *          operating system and arrays are backed by normal pages.
+ * @date October 17, 2026
+ */
+
+#ifndef NUMA_H_
+#define NUMA_H_
+
+#ifdef __cplusplus
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+#include "log.h"
+#endif
+
+
+/** The maximum number of NUMA nodes which pages may be placed on */
+#define MAX_NUMA_NODES 64
+
+/** The size (bytes) of a 2 MB huge page */
+#define HUGE_PAGE_SIZE_2MB (2L*1024*1024)
+
+/** The size (bytes) of a 1 GB huge page */
+#define HUGE_PAGE_SIZE_1GB (1024L*1024*1024)
+
+/** The alignment (bytes) of arrays allocated by huge_page_malloc(...),
+ *  which is also the size of the header preceding each array */
+#define HUGE_PAGE_ALIGNMENT 64
+
+
+/**
+ * @enum threadAffinity
+ * @brief The pinning of OpenMP threads to the cores of a shared memory
+ *        machine.
+ */
+enum threadAffinity {
+
+  /** The threads are not pinned and may be moved by the operating system */
+  AFFINITY_NONE,
+
+  /** Consecutive threads are pinned to the cores of one NUMA node before
+   *  those of the next node */
+  AFFINITY_COMPACT,
+
+  /** Consecutive threads are pinned to the cores of alternating NUMA
+   *  nodes */
+  AFFINITY_SCATTER
+};
+
+
+/**
+ * @enum pagePlacement
+ * @brief The placement of the memory pages of an array on NUMA nodes.
+ */
+enum pagePlacement {
+
+  /** Each page is placed on the NUMA node of the thread which first
+   *  writes to it */
+  FIRST_TOUCH,
+
+  /** The pages are interleaved across all NUMA nodes */
+  INTERLEAVED
+};
+
+
+/**
+ * @enum hugePageType
+ * @brief The pages backing large arrays to reduce TLB misses.
+ */
+enum hugePageType {
+
+  /** The array is backed by normal pages */
+  NO_HUGE_PAGES,
+
+  /** The operating system is advised to back the array with transparent
+   *  huge pages where it can */
+  TRANSPARENT_HUGE_PAGES,
+
+  /** The array is backed by reserved 2 MB huge pages */
+  HUGE_PAGES_2MB,
+
+  /** The array is backed by reserved 1 GB huge pages */
+  HUGE_PAGES_1GB
+};
+
+
+int get_num_numa_nodes();
+int get_numa_node_of_cpu(int cpu);
+void pin_openmp_threads(threadAffinity affinity);
+bool interleave_pages(void* ptr, size_t size);
+bool count_numa_pages(void* ptr, size_t size, long* num_node_pages);
+void* huge_page_malloc(size_t size, hugePageType huge_pages);
+void huge_page_free(void* ptr);
+void start_tlb_miss_count();
+long stop_tlb_miss_count();
+
+#endif /* NUMA_H_ */
@@ -1,6 +1,6 @@
 /**
  * @file pairwise_sum.h
- * @brief Utility function for the accurate pairwise sum of a list of floating
+ * @brief Utility functions for the accurate pairwise sum of a list of floating
  *        point numbers.
  * @author William Boyd (wboyd@mit.edu)
  * @date June 13, 2013
@@ -37,3 +37,137 @@ inline T pairwise_sum(T* vector, int length) {
 
   return sum;
 }
+
+
+/** The minimum length of an array to sum with multiple threads */
+#define PARALLEL_SUM_MIN_LENGTH 16384
+
+/** The minimum length of each subarray summed by a thread */
+#define PARALLEL_SUM_MIN_BLOCK 1024
+
+/** The maximum depth of the pairwise summation tree split across threads */
+#define PARALLEL_SUM_MAX_DEPTH 8
+
+
+/**
+ * @brief Splits an array into subarrays along the top levels of the
+ *        divide-and-conquer tree used by pairwise_sum(...).
+ * @param length the length of the array
+ * @param offsets an array to store the offset of each subarray
+ * @param lengths an array to store the length of each subarray
+ * @return the depth of the tree, such that there are 2^depth subarrays
+ */
+inline int pairwise_sum_blocks(int length, int* offsets, int* lengths) {
+
+  /* Find the depth of the tree to split across threads */
+  int depth = 0;
+  while (depth < PARALLEL_SUM_MAX_DEPTH &&
+         (length >> (depth+1)) >= PARALLEL_SUM_MIN_BLOCK)
+    depth++;
+
+  /* Split each subarray into halves as in pairwise_sum(...) */
+  offsets[0] = 0;
+  lengths[0] = length;
+
+  for (int level=0; level < depth; level++) {
+    for (int b=(1 << level)-1; b >= 0; b--) {
+      int half = lengths[b] / 2;
+      offsets[2*b] = offsets[b];
+      offsets[2*b+1] = offsets[b] + half;
+      lengths[2*b+1] = lengths[b] - half;
+      lengths[2*b] = half;
+    }
+  }
+
+  return depth;
+}
+
+
+/**
+ * @brief Performs a pairwise sum of an array of numbers with OpenMP threads.
+ * @details The array is split into subarrays along the top levels of the
+ *          same divide-and-conquer tree used by pairwise_sum(...). The
+ *          subarrays are summed concurrently and their sums are combined
+ *          in the order of the tree. Since the tree depends only on the
+ *          length of the array, the sum is bit-identical to that of
+ *          pairwise_sum(...) for any number of threads.
+ * @param vector an array of numbers
+ * @param length the length of the array
+ * @return the sum of all numbers in the array
+ */
+template <typename T>
+inline T parallel_pairwise_sum(T* vector, int length) {
+
+  /* Short arrays are summed by a single thread */
+  if (length < PARALLEL_SUM_MIN_LENGTH)
+    return pairwise_sum<T>(vector, length);
+
+  int offsets[1 << PARALLEL_SUM_MAX_DEPTH];
+  int lengths[1 << PARALLEL_SUM_MAX_DEPTH];
+  T sums[1 << PARALLEL_SUM_MAX_DEPTH];
+
+  int depth = pairwise_sum_blocks(length, offsets, lengths);
+  int num_blocks = 1 << depth;
+
+  /* Sum each subarray concurrently */
+  #pragma omp parallel for schedule(static)
+  for (int b=0; b < num_blocks; b++)
+    sums[b] = pairwise_sum<T>(&vector[offsets[b]], lengths[b]);
+
+  /* Combine the subarray sums in the order of the tree */
+  for (int level=depth; level > 0; level--) {
+    for (int b=0; b < (1 << (level-1)); b++)
+      sums[b] = sums[2*b] + sums[2*b+1];
+  }
+
+  return sums[0];
+}
+
+
+/**
+ * @brief Performs a pairwise sum of an array of numbers with the threads of
+ *        an enclosing OpenMP parallel region.
+ * @details This must be called by all threads of the team. Each thread sums
+ *          some of the subarrays of parallel_pairwise_sum(...) into an array
+ *          shared by the team, and each thread then combines the subarray
+ *          sums in the order of the tree, such that all threads return the
+ *          same sum as parallel_pairwise_sum(...) without forking a team.
+ * @param vector an array of numbers
+ * @param length the length of the array
+ * @param sums an array shared by the team of length
+ *        2^PARALLEL_SUM_MAX_DEPTH for the subarray sums
+ * @return the sum of all numbers in the array
+ */
+template <typename T>
+inline T team_pairwise_sum(T* vector, int length, T* sums) {
+
+  /* Short arrays are summed by each thread */
+  if (length < PARALLEL_SUM_MIN_LENGTH)
+    return pairwise_sum<T>(vector, length);
+
+  int offsets[1 << PARALLEL_SUM_MAX_DEPTH];
+  int lengths[1 << PARALLEL_SUM_MAX_DEPTH];
+  T thread_sums[1 << PARALLEL_SUM_MAX_DEPTH];
+
+  int depth = pairwise_sum_blocks(length, offsets, lengths);
+  int num_blocks = 1 << depth;
+
+  /* Sum each subarray with the threads of the team */
+  #pragma omp for schedule(static)
+  for (int b=0; b < num_blocks; b++)
+    sums[b] = pairwise_sum<T>(&vector[offsets[b]], lengths[b]);
+
+  for (int b=0; b < num_blocks; b++)
+    thread_sums[b] = sums[b];
+
+  /* Wait for all threads to read the subarray sums before they are reused */
+  #pragma omp barrier
+
+  /* Combine the subarray sums in the order of the tree */
+  for (int level=depth; level > 0; level--) {
+    for (int b=0; b < (1 << (level-1)); b++)
+      thread_sums[b] = thread_sums[2*b] + thread_sums[2*b+1];
+  }
+
+  return thread_sums[0];
+}
@@ -0,0 +1,269 @@
+#include "simd.h"
+
+
+/* The x86 instruction sets are only compiled with compilers supporting
+ * GNU function target attributes and CPU feature detection */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86
+#endif
+
+/** The polynomial degree for the vector exponential to machine precision */
+#ifdef SINGLE
+#define SIMD_EXP_POLY_DEGREE 7
+#else
+#define SIMD_EXP_POLY_DEGREE MAX_EXP_POLY_DEGREE
+#endif
+
+
+/** The polynomial coefficients \f$ 1/k! \f$ for the vector exponential */
+static const FP_PRECISION _simd_exp_coefficients[MAX_EXP_POLY_DEGREE+1] =
+  {1., 1., 1./2., 1./6., 1./24., 1./120., 1./720., 1./5040., 1./40320.,
+   1./362880., 1./3628800., 1./39916800., 1./479001600., 1./6227020800.};
+
+
+/* The portable kernels vectorized with OpenMP SIMD constructs */
+#define SIMD_TARGET
+#define SIMD_NAME(name) simd_##name##_generic
+#include "simd_kernels.h"
+#undef SIMD_TARGET
+#undef SIMD_NAME
+
+#ifdef SIMD_X86
+
+/* The kernels for SSE2 */
+#define SIMD_TARGET __attribute__((target("sse2")))
+#define SIMD_NAME(name) simd_##name##_sse2
+#include "simd_kernels.h"
+#undef SIMD_TARGET
+#undef SIMD_NAME
+
+/* The kernels for AVX2 with fused multiply-add */
+#define SIMD_TARGET __attribute__((target("avx2,fma")))
+#define SIMD_NAME(name) simd_##name##_avx2
+#include "simd_kernels.h"
+#undef SIMD_TARGET
+#undef SIMD_NAME
+
+/* The kernels for AVX-512 */
+#define SIMD_TARGET __attribute__((target("avx512f")))
+#define SIMD_NAME(name) simd_##name##_avx512
+#include "simd_kernels.h"
+#undef SIMD_TARGET
+#undef SIMD_NAME
+
+#endif
+
+
+/** The instruction set used by the vector kernels */
+static simdInstructionSet _simd_instruction_set = SIMD_GENERIC;
+
+/** Whether the instruction set has been selected */
+static bool _simd_initialized = false;
+
+/* Pointers to the vector kernels for the selected instruction set */
+static FP_PRECISION (*_simd_sum)(int, FP_PRECISION*) = simd_sum_generic;
+static void (*_simd_scale)(int, FP_PRECISION, FP_PRECISION*) =
+     simd_scale_generic;
+static void (*_simd_add)(int, FP_PRECISION*, FP_PRECISION*) =
+     simd_add_generic;
+static void (*_simd_exp)(int, FP_PRECISION*, FP_PRECISION*) =
+     simd_exp_generic;
+
+
+/**
+ * @brief Detects the widest instruction set supported by the processor
+ *        and operating system for which the vector kernels are compiled.
+ * @return the instruction set
+ */
+simdInstructionSet detect_simd_instruction_set() {
+
+#ifdef SIMD_X86
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f"))
+    return SIMD_AVX512;
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return SIMD_AVX2;
+  else if (__builtin_cpu_supports("sse2"))
+    return SIMD_SSE2;
+#endif
+
+  return SIMD_GENERIC;
+}
+
+
+/**
+ * @brief Selects the instruction set for the vector kernels.
+ * @details This may be used to select a narrower instruction set than the
+ *          one detected for the processor, for instance to compare the
+ *          performance of each instruction set:
+ *
+ * @code
+ *          import openmoc.gnu.double as simd
+ *          simd.set_simd_instruction_set(simd.SIMD_SSE2)
+ * @endcode
+ *
+ * @param instruction_set the instruction set
+ */
+void set_simd_instruction_set(simdInstructionSet instruction_set) {
+
+  if (instruction_set > detect_simd_instruction_set())
+    log_printf(ERROR, "Unable to set the SIMD instruction set to %s since "
+               "it is not supported by this processor",
+               get_simd_instruction_set_name(instruction_set));
+
+  switch (instruction_set) {
+#ifdef SIMD_X86
+  case SIMD_AVX512:
+    _simd_sum = simd_sum_avx512;
+    _simd_scale = simd_scale_avx512;
+    _simd_add = simd_add_avx512;
+    _simd_exp = simd_exp_avx512;
+    break;
+  case SIMD_AVX2:
+    _simd_sum = simd_sum_avx2;
+    _simd_scale = simd_scale_avx2;
+    _simd_add = simd_add_avx2;
+    _simd_exp = simd_exp_avx2;
+    break;
+  case SIMD_SSE2:
+    _simd_sum = simd_sum_sse2;
+    _simd_scale = simd_scale_sse2;
+    _simd_add = simd_add_sse2;
+    _simd_exp = simd_exp_sse2;
+    break;
+#endif
+  default:
+    _simd_sum = simd_sum_generic;
+    _simd_scale = simd_scale_generic;
+    _simd_add = simd_add_generic;
+    _simd_exp = simd_exp_generic;
+  }
+
+  _simd_instruction_set = instruction_set;
+  _simd_initialized = true;
+
+  log_printf(INFO, "Using the %s SIMD instruction set",
+             get_simd_instruction_set_name(instruction_set));
+}
+
+
+/**
+ * @brief Returns the instruction set used by the vector kernels.
+ * @return the instruction set
+ */
+simdInstructionSet get_simd_instruction_set() {
+  return _simd_instruction_set;
+}
+
+
+/**
+ * @brief Returns the name of an instruction set.
+ * @param instruction_set the instruction set
+ * @return a character array for the name
+ */
+const char* get_simd_instruction_set_name(simdInstructionSet instruction_set) {
+
+  switch (instruction_set) {
+  case SIMD_SSE2:
+    return "SSE2";
+  case SIMD_AVX2:
+    return "AVX2";
+  case SIMD_AVX512:
+    return "AVX-512";
+  default:
+    return "generic";
+  }
+}
+
+
+/**
+ * @brief Selects the widest supported instruction set for the vector
+ *        kernels unless one has already been selected.
+ * @details This is called by the VectorizedSolver before any of the
+ *          vector kernels are used and should not be called from
+ *          within a parallel region.
+ */
+void initialize_simd() {
+  if (!_simd_initialized)
+    set_simd_instruction_set(detect_simd_instruction_set());
+}
+
+
+/**
+ * @brief Computes the sum of an array.
+ * @param length the length of the array
+ * @param x the array to sum
+ * @return the sum of the array
+ */
+FP_PRECISION simd_sum(int length, FP_PRECISION* x) {
+  return _simd_sum(length, x);
+}
+
+
+/**
+ * @brief Scales an array by a constant, \f$ x = \alpha x \f$.
+ * @param length the length of the array
+ * @param alpha the scaling factor
+ * @param x the array to scale
+ */
+void simd_scale(int length, FP_PRECISION alpha, FP_PRECISION* x) {
+  _simd_scale(length, alpha, x);
+}
+
+
+/**
+ * @brief Adds one array to another, \f$ y = y + x \f$.
+ * @param length the length of the arrays
+ * @param x the array to add
+ * @param y the array to add to
+ */
+void simd_add(int length, FP_PRECISION* x, FP_PRECISION* y) {
+  _simd_add(length, x, y);
+}
+
+
+/**
+ * @brief Computes the exponential of each value in an array of
+ *        non-positive values, \f$ y = exp(x) \f$.
+ * @details The exponentials are approximated to machine precision by
+ *          exponential_poly_neg(...), and exponentials smaller than the
+ *          smallest normalized floating point number are flushed to zero.
+ * @param length the length of the arrays
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+void simd_exp(int length, FP_PRECISION* x, FP_PRECISION* y) {
+  _simd_exp(length, x, y);
+}
+
+
+/**
+ * @brief Allocates memory aligned for the vector kernels.
+ * @details The memory is aligned to the larger of VEC_ALIGNMENT and the
+ *          width of an AVX-512 vector. An exception is thrown if the
+ *          memory cannot be allocated.
+ * @param size the number of bytes to allocate
+ * @return a pointer to the memory
+ */
+void* simd_malloc(size_t size) {
+
+  size_t alignment = VEC_ALIGNMENT;
+  if (alignment < SIMD_MIN_ALIGNMENT)
+    alignment = SIMD_MIN_ALIGNMENT;
+
+  void* ptr = NULL;
+  if (posix_memalign(&ptr, alignment, size) != 0)
+    throw std::bad_alloc();
+
+  return ptr;
+}
+
+
+/**
+ * @brief Frees memory allocated by simd_malloc(...).
+ * @param ptr a pointer to the memory
+ */
+void simd_free(void* ptr) {
+  free(ptr);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file simd.h
+ * @brief Utility functions for SIMD vector arithmetic
+ * @details Provides vector kernels which are compiled for several x86
+ *          instruction sets (SSE2, AVX2 and AVX-512) and selected at
+ *          runtime from the features reported by the processor, with
+ *          an OpenMP SIMD fallback for other architectures.
+ * @date October 17, 2026
+ */
+
+#ifndef SIMD_H_
+#define SIMD_H_
+
+#ifdef __cplusplus
+#include <stdlib.h>
+#include <math.h>
+#include <new>
+#include "log.h"
+#include "exponential.h"
+#endif
+
+
+/** Expands and applies a pragma from a macro */
+#define SIMD_PRAGMA(x) _Pragma(#x)
+#define SIMD_EXPAND_PRAGMA(x) SIMD_PRAGMA(x)
+
+/**
+ * @brief A hint to the compiler to vectorize the loop which follows in
+ *        chunks of VEC_LENGTH iterations.
+ * @details This uses Intel's SIMD pragma when compiled with the Intel
+ *          compiler and the OpenMP 4.0 SIMD construct otherwise.
+ */
+#if defined(INTEL)
+#define VECTOR_LOOP SIMD_EXPAND_PRAGMA(simd vectorlength(VEC_LENGTH))
+#elif defined(_OPENMP) && _OPENMP >= 201307
+#define VECTOR_LOOP SIMD_EXPAND_PRAGMA(omp simd simdlen(VEC_LENGTH))
+#else
+#define VECTOR_LOOP
+#endif
+
+/** The smallest alignment (bytes) for arrays used by the SIMD kernels
+ *  which is needed for aligned AVX-512 loads and stores */
+#define SIMD_MIN_ALIGNMENT 64
+
+
+/**
+ * @enum simdInstructionSets
+ * @brief The instruction sets which the SIMD kernels are compiled for.
+ */
+
+/**
+ * @var simdInstructionSet
+ * @brief The instruction sets which the SIMD kernels are compiled for.
+ */
+typedef enum simdInstructionSets {
+  /** Portable code vectorized with OpenMP SIMD constructs */
+  SIMD_GENERIC,
+
+  /** The x86 Streaming SIMD Extensions 2 (128 bit vectors) */
+  SIMD_SSE2,
+
+  /** The x86 Advanced Vector Extensions 2 with FMA (256 bit vectors) */
+  SIMD_AVX2,
+
+  /** The x86 Advanced Vector Extensions 512 Foundation (512 bit vectors) */
+  SIMD_AVX512
+} simdInstructionSet;
+
+
+/* Functions to detect and select the instruction set */
+simdInstructionSet detect_simd_instruction_set();
+void set_simd_instruction_set(simdInstructionSet instruction_set);
+simdInstructionSet get_simd_instruction_set();
+const char* get_simd_instruction_set_name(simdInstructionSet instruction_set);
+void initialize_simd();
+
+/* Runtime dispatched vector kernels */
+FP_PRECISION simd_sum(int length, FP_PRECISION* x);
+void simd_scale(int length, FP_PRECISION alpha, FP_PRECISION* x);
+void simd_add(int length, FP_PRECISION* x, FP_PRECISION* y);
+void simd_exp(int length, FP_PRECISION* x, FP_PRECISION* y);
+
+/* Aligned memory for the vector kernels */
+void* simd_malloc(size_t size);
+void simd_free(void* ptr);
+
+#endif /* SIMD_H_ */
@@ -0,0 +1,76 @@
+/**
+ * @file simd_kernels.h
+ * @brief The vector kernels for one instruction set.
+ * @details This file is included by simd.cpp once for each instruction set.
+ *          Before each inclusion, SIMD_TARGET is defined as the function
+ *          attribute which enables the instruction set and SIMD_NAME(name)
+ *          appends the instruction set to each kernel's name.
+ * @date October 17, 2026
+ */
+
+/* This file is intentionally not guarded against multiple inclusion */
+
+
+/**
+ * @brief Computes the sum of an array.
+ * @param length the length of the array
+ * @param x the array to sum
+ * @return the sum of the array
+ */
+SIMD_TARGET static FP_PRECISION SIMD_NAME(sum)(int length, FP_PRECISION* x) {
+
+  FP_PRECISION sum = 0.;
+
+  #pragma omp simd reduction(+:sum)
+  for (int i=0; i < length; i++)
+    sum += x[i];
+
+  return sum;
+}
+
+
+/**
+ * @brief Scales an array by a constant, \f$ x = \alpha x \f$.
+ * @param length the length of the array
+ * @param alpha the scaling factor
+ * @param x the array to scale
+ */
+SIMD_TARGET static void SIMD_NAME(scale)(int length, FP_PRECISION alpha,
+                                         FP_PRECISION* x) {
+
+  #pragma omp simd
+  for (int i=0; i < length; i++)
+    x[i] *= alpha;
+}
+
+
+/**
+ * @brief Adds one array to another, \f$ y = y + x \f$.
+ * @param length the length of the arrays
+ * @param x the array to add
+ * @param y the array to add to
+ */
+SIMD_TARGET static void SIMD_NAME(add)(int length, FP_PRECISION* x,
+                                       FP_PRECISION* y) {
+
+  #pragma omp simd
+  for (int i=0; i < length; i++)
+    y[i] += x[i];
+}
+
+
+/**
+ * @brief Computes the exponential of each value in an array of
+ *        non-positive values, \f$ y = exp(x) \f$.
+ * @param length the length of the arrays
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+SIMD_TARGET static void SIMD_NAME(exp)(int length, FP_PRECISION* x,
+                                       FP_PRECISION* y) {
+
+  #pragma omp simd
+  for (int i=0; i < length; i++)
+    y[i] = exponential_poly_neg(-x[i], _simd_exp_coefficients,
+                                SIMD_EXP_POLY_DEGREE);
+}
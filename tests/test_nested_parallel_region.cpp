@@ -0,0 +1,154 @@
+/**
+ * @file test_nested_parallel_region.cpp
+ * @brief Regression check for converging the source from within a parallel
+ *        region of the calling application.
+ * @details The steps of a source iteration share their loops among the
+ *          team forked by the CPUSolver, and must fork a team of their own
+ *          when called by any other team, such as that of an application
+ *          which calls the solver from a single thread of its own parallel
+ *          region. This converges the source of a one group pin cell
+ *          outside of any parallel region, and again from an enclosing
+ *          parallel region with and without a persistent parallel region,
+ *          and checks that \f$ k_{eff} \f$ is the same each time. It may be
+ *          built and run from the top directory as follows:
+ *
+ * @code
+ *          g++ -O2 -fopenmp -std=c++0x -DFP_PRECISION=double \
+ *              -DVEC_LENGTH=8 -DVEC_ALIGNMENT=16 -Isrc \
+ *              tests/test_nested_parallel_region.cpp src/*.cpp \
+ *              -o test_nested_parallel_region
+ *          ./test_nested_parallel_region
+ * @endcode
+ *
+ * @date October 17, 2026
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <omp.h>
+#include "../src/CPUSolver.h"
+
+
+/**
+ * @brief Creates a one group Material.
+ * @param id the Material ID
+ * @param sigma_a the absorption cross-section
+ * @param sigma_s the scattering cross-section
+ * @param nu_sigma_f the fission production cross-section
+ * @return a pointer to the Material
+ */
+static Material* createMaterial(int id, double sigma_a, double sigma_s,
+                                double nu_sigma_f) {
+
+  double sigma_t = sigma_a + sigma_s;
+  double sigma_f = nu_sigma_f / 2.4;
+  double chi = nu_sigma_f > 0. ? 1. : 0.;
+
+  Material* material = new Material(id);
+  material->setNumEnergyGroups(1);
+  material->setSigmaT(&sigma_t, 1);
+  material->setSigmaA(&sigma_a, 1);
+  material->setSigmaS(&sigma_s, 1);
+  material->setSigmaF(&sigma_f, 1);
+  material->setNuSigmaF(&nu_sigma_f, 1);
+  material->setChi(&chi, 1);
+
+  return material;
+}
+
+
+/**
+ * @brief Converges the source of a pin cell, from an enclosing parallel
+ *        region if requested.
+ * @param geometry the Geometry of the pin cell
+ * @param track_generator the TrackGenerator for the pin cell
+ * @param nested whether to converge the source from a parallel region
+ * @param persistent whether to use a persistent parallel region
+ * @return the eigenvalue \f$ k_{eff} \f$
+ */
+static double convergeSource(Geometry* geometry,
+                             TrackGenerator* track_generator, bool nested,
+                             bool persistent) {
+
+  CPUSolver solver(geometry, track_generator);
+  solver.setNumThreads(2);
+  solver.setSourceConvergenceThreshold(1E-6);
+  solver.setPersistentParallelRegion(persistent);
+
+  double k_eff = 0.;
+
+  if (nested) {
+    #pragma omp parallel num_threads(2)
+    {
+      #pragma omp single
+      k_eff = solver.convergeSource(1000);
+    }
+  }
+  else
+    k_eff = solver.convergeSource(1000);
+
+  return k_eff;
+}
+
+
+int main() {
+
+  set_log_level("WARNING");
+
+  Geometry geometry;
+  geometry.addMaterial(createMaterial(1, 0.1, 0.4, 0.15));
+  geometry.addMaterial(createMaterial(2, 0.01, 0.99, 0.));
+
+  Circle circle(0., 0., 0.4);
+  XPlane left(-0.63);
+  XPlane right(0.63);
+  YPlane bottom(-0.63);
+  YPlane top(0.63);
+  left.setBoundaryType(REFLECTIVE);
+  right.setBoundaryType(REFLECTIVE);
+  bottom.setBoundaryType(REFLECTIVE);
+  top.setBoundaryType(REFLECTIVE);
+
+  CellBasic* fuel = new CellBasic(1, 1, 2, 4);
+  CellBasic* moderator = new CellBasic(1, 2, 0, 4);
+  CellFill* root = new CellFill(0, 2);
+  fuel->addSurface(-1, &circle);
+  moderator->addSurface(+1, &circle);
+  root->addSurface(+1, &left);
+  root->addSurface(-1, &right);
+  root->addSurface(+1, &bottom);
+  root->addSurface(-1, &top);
+
+  geometry.addCell(fuel);
+  geometry.addCell(moderator);
+  geometry.addCell(root);
+
+  Lattice* lattice = new Lattice(2, 1.26, 1.26);
+  int universes[1] = {1};
+  lattice->setLatticeCells(1, 1, universes);
+  geometry.addLattice(lattice);
+  geometry.initializeFlatSourceRegions();
+
+  TrackGenerator track_generator(&geometry, 8, 0.05);
+  track_generator.generateTracks();
+
+  double reference = convergeSource(&geometry, &track_generator, false,
+                                    false);
+  int num_failed = 0;
+
+  for (int persistent=0; persistent < 2; persistent++) {
+
+    double k_eff = convergeSource(&geometry, &track_generator, true,
+                                  persistent);
+    bool passed = fabs(k_eff - reference) < 1E-10;
+
+    printf("%s: nested parallel region (persistent = %d), k_eff = %.10f, "
+           "reference = %.10f\n", passed ? "PASSED" : "FAILED", persistent,
+           k_eff, reference);
+
+    if (!passed)
+      num_failed++;
+  }
+
+  return num_failed;
+}